@@ -1,15 +1,154 @@
 #ifndef ITERATORM_HPP
 #define ITERATORM_HPP
 
+#include <atomic>
+#include <cstdint>
 #include "matriz/Matriz.hpp"
 
 class Matriz;
 
+/**
+ * @class ConstIteratorM
+ * @brief Iterador somente leitura para percorrer uma matriz esparsa.
+ *
+ * Retornado por Matriz::begin() const e Matriz::end() const. A desreferenciação entrega uma referência
+ * constante ao valor, de modo que percorrer uma matriz const (ou uma cópia que compartilha a estrutura)
+ * não pode alterar os nós compartilhados, e não separa nem altera a versão da matriz.
+ */
+class ConstIteratorM
+{
+private:
+    const Node *cabecalho; /**< Ponteiro para o nó de cabeçalho. */
+    const Node *current;   /**< Ponteiro para o nó atual. */
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = double;
+    using pointer = const double *;
+    using reference = const double &;
+
+    /**
+     * @brief Construtor padrão.
+     *
+     * Inicializa o iterador com ponteiros nulos.
+     */
+    ConstIteratorM() : cabecalho(nullptr), current(nullptr) {}
+
+    /**
+     * @brief Construtor com parâmetros.
+     *
+     * Inicializa o iterador com o nó de cabeçalho e o nó atual.
+     *
+     * @param cabecalho Ponteiro para o nó de cabeçalho.
+     * @param current Ponteiro para o nó atual.
+     */
+    ConstIteratorM(const Node *cabecalho, const Node *current) : cabecalho(cabecalho), current(current)
+    {
+        // Pula linhas vazias (os parâmetros têm o mesmo nome dos membros, daí o this->)
+        while (this->current == this->cabecalho)
+        {
+            this->cabecalho = this->cabecalho->abaixo;
+            this->current = this->current->abaixo->direita;
+        }
+    }
+
+    /**
+     * @brief Operador de desreferenciação.
+     *
+     * @return Referência constante ao valor do nó atual.
+     */
+    reference operator*() const
+    {
+        return current->valor;
+    }
+
+    /**
+     * @brief Operador de acesso a membro.
+     *
+     * @return Ponteiro constante para o valor do nó atual.
+     */
+    pointer operator->() const
+    {
+        return &current->valor;
+    }
+
+    /**
+     * @brief Retorna a linha do elemento atual.
+     *
+     * @return Índice (a partir de 1) da linha do nó apontado pelo iterador.
+     */
+    int linha() const
+    {
+        return current->linha;
+    }
+
+    /**
+     * @brief Retorna a coluna do elemento atual.
+     *
+     * @return Índice (a partir de 1) da coluna do nó apontado pelo iterador.
+     */
+    int coluna() const
+    {
+        return current->coluna;
+    }
+
+    /**
+     * @brief Operador de incremento prefixado.
+     *
+     * Avança o iterador para o próximo elemento na matriz esparsa.
+     *
+     * @return Referência ao próprio iterador após o incremento.
+     */
+    ConstIteratorM &operator++()
+    {
+        current = current->direita;
+
+        while (current == cabecalho)
+        {
+            cabecalho = cabecalho->abaixo;
+            current = current->abaixo->direita;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Operador de igualdade.
+     *
+     * @param it Iterador a ser comparado.
+     * @return true se os iteradores são iguais, false caso contrário.
+     */
+    bool operator==(const ConstIteratorM &it) const
+    {
+        return cabecalho == it.cabecalho && current == it.current;
+    }
+
+    /**
+     * @brief Operador de desigualdade.
+     *
+     * @param it Iterador a ser comparado.
+     * @return true se os iteradores são diferentes, false caso contrário.
+     */
+    bool operator!=(const ConstIteratorM &it) const
+    {
+        return cabecalho != it.cabecalho || current != it.current;
+    }
+};
+
 /**
  * @class IteratorM
- * @brief Iterador para percorrer uma matriz esparsa.
+ * @brief Iterador para percorrer e alterar os valores de uma matriz esparsa.
+ *
+ * A classe IteratorM fornece um iterador para percorrer os elementos de uma matriz esparsa. Ele é
+ * retornado por Matriz::begin() e Matriz::end() não const, que separam a estrutura de eventuais
+ * cópias (copy-on-write) antes de entregá-lo.
  *
- * A classe IteratorM fornece um iterador para percorrer os elementos de uma matriz esparsa.
+ * @details
+ * - A desreferenciação entrega um ReferenciaValor: ler o valor não altera a matriz, e cada escrita
+ *   avança a versão da estrutura (Matriz::getVersao()), como insert().
+ * - Copiar a matriz (ou criar uma visão dela) invalida os iteradores mutáveis já obtidos: uma
+ *   escrita por eles apareceria também na cópia. Obtenha um novo iterador depois da cópia.
  *
  * @friend class Matriz
  */
@@ -18,22 +157,61 @@ class IteratorM
     friend class Matriz;
 
 private:
-    Node *cabecalho; /**< Ponteiro para o nó de cabeçalho. */
-    Node *current;   /**< Ponteiro para o nó atual. */
+    Node *cabecalho;               /**< Ponteiro para o nó de cabeçalho. */
+    Node *current;                 /**< Ponteiro para o nó atual. */
+    std::atomic<uint64_t> *versao; /**< Versão da estrutura percorrida, avançada a cada escrita (pode ser nulo). */
 
 public:
+    /**
+     * @brief Referência ao valor de um nó que avança a versão da estrutura a cada escrita.
+     */
+    class ReferenciaValor
+    {
+    private:
+        Node *no;                      /**< Nó referenciado. */
+        std::atomic<uint64_t> *versao; /**< Versão da estrutura do nó (pode ser nulo). */
+
+        void alterado()
+        {
+            if (versao)
+                versao->fetch_add(1, std::memory_order_relaxed);
+        }
+
+    public:
+        ReferenciaValor(Node *no, std::atomic<uint64_t> *versao) : no(no), versao(versao) {}
+
+        operator double() const { return no->valor; }
+
+        ReferenciaValor &operator=(const double &valor)
+        {
+            no->valor = valor;
+            alterado();
+            return *this;
+        }
+
+        ReferenciaValor &operator=(const ReferenciaValor &outra)
+        {
+            return *this = static_cast<double>(outra);
+        }
+
+        ReferenciaValor &operator+=(const double &valor) { return *this = no->valor + valor; }
+        ReferenciaValor &operator-=(const double &valor) { return *this = no->valor - valor; }
+        ReferenciaValor &operator*=(const double &valor) { return *this = no->valor * valor; }
+        ReferenciaValor &operator/=(const double &valor) { return *this = no->valor / valor; }
+    };
+
     using iterator_category = std::forward_iterator_tag;
     using difference_type = std::ptrdiff_t;
     using value_type = double;
-    using pointer = double *;
-    using reference = double &;
+    using pointer = const double *;
+    using reference = ReferenciaValor;
 
     /**
      * @brief Construtor padrão.
      *
      * Inicializa o iterador com ponteiros nulos.
      */
-    IteratorM() : cabecalho(nullptr), current(nullptr) {}
+    IteratorM() : cabecalho(nullptr), current(nullptr), versao(nullptr) {}
 
     /**
      * @brief Construtor com parâmetros.
@@ -42,62 +220,61 @@ public:
      *
      * @param cabecalho Ponteiro para o nó de cabeçalho.
      * @param current Ponteiro para o nó atual (padrão é nullptr).
+     * @param versao Versão da estrutura, avançada a cada escrita pelo iterador (nulo para não registrar).
      */
-    IteratorM(Node *cabecalho, Node *current) : cabecalho(cabecalho), current(current)
+    IteratorM(Node *cabecalho, Node *current, std::atomic<uint64_t> *versao = nullptr)
+        : cabecalho(cabecalho), current(current), versao(versao)
     {
-        while (current == cabecalho)
+        // Pula linhas vazias (os parâmetros têm o mesmo nome dos membros, daí o this->)
+        while (this->current == this->cabecalho)
         {
-            cabecalho = cabecalho->abaixo;
-            current = current->abaixo->direita;
+            this->cabecalho = this->cabecalho->abaixo;
+            this->current = this->current->abaixo->direita;
         }
     }
 
     /**
      * @brief Operador de desreferenciação.
      *
-     * Retorna uma referência ao valor do nó atual.
+     * Retorna uma referência ao valor do nó atual; escrever nela avança a versão da matriz.
      *
      * @return Referência ao valor do nó atual.
      */
-    reference operator*()
+    reference operator*() const
     {
-        return current->valor;
+        return ReferenciaValor(current, versao);
     }
 
     /**
-     * @brief Operador de desreferenciação (const).
+     * @brief Operador de acesso a membro.
      *
-     * Retorna uma referência constante ao valor do nó atual.
+     * Retorna um ponteiro constante para o valor do nó atual; as escritas passam por operator*().
      *
-     * @return Referência constante ao valor do nó atual.
+     * @return Ponteiro constante para o valor do nó atual.
      */
-    reference operator*() const
+    pointer operator->() const
     {
-        return current->valor;
+        return &current->valor;
     }
 
     /**
-     * @brief Operador de acesso a membro (const).
+     * @brief Retorna a linha do elemento atual.
      *
-     * Retorna um ponteiro constante para o valor do nó atual.
-     *
-     * @return Ponteiro constante para o valor do nó atual.
+     * @return Índice (a partir de 1) da linha do nó apontado pelo iterador.
      */
-    pointer operator->()
+    int linha() const
     {
-        return &current->valor;
+        return current->linha;
     }
 
     /**
-     * @brief Operador de acesso a membro (const).
-     *
-     * Retorna um ponteiro constante para o valor do nó atual.
+     * @brief Retorna a coluna do elemento atual.
      *
-     * @return Ponteiro constante para o valor do nó atual.
+     * @return Índice (a partir de 1) da coluna do nó apontado pelo iterador.
      */
-    pointer operator->() const
+    int coluna() const
     {
-        return &current->valor;
+        return current->coluna;
     }
 
     /**
@@ -120,6 +297,14 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Conversão para o iterador somente leitura na mesma posição.
+     */
+    operator ConstIteratorM() const
+    {
+        return ConstIteratorM(cabecalho, current);
+    }
+
     /**
      * @brief Operador de igualdade.
      *
@@ -147,4 +332,4 @@ public:
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,165 @@
+#ifndef MATRIZ_IO_HPP
+#define MATRIZ_IO_HPP
+
+#include <string>
+#include <atomic>
+#include <variant>
+#include "matriz/Matriz.hpp"
+#include "matrizDiagonal/MatrizDiagonal.hpp"
+
+/**
+ * @file MatrizIO.hpp
+ * @brief Leitura e escrita de matrizes esparsas em arquivo.
+ *
+ * Formatos suportados:
+ * - Texto: primeira linha "linhas colunas", seguida de uma linha "i j valor" por elemento.
+ * - Binário (.bin): cabeçalho "MESP", versão, dimensões e quantidade de elementos, seguido dos
+ *   elementos (int32 linha, int32 coluna, double valor) em ordem de linhas. Evita a conversão
+ *   de texto e é o formato preferido para resultados intermediários.
+ * - Matrix Market (.mtx): formato "coordinate" com campos real, integer ou pattern e simetria
+ *   general ou symmetric. A leitura divide o arquivo em blocos interpretados em paralelo.
+ * - Compactado (.mec): linhas não vazias com o salto desde a linha anterior, a quantidade de
+ *   elementos e as colunas codificadas como diferenças em varint; os valores são gravados como
+ *   double, float, inteiros em varint ou índices de um dicionário de valores distintos. Veja
+ *   escreverMatrizCompactada().
+ *
+ * A leitura monta a matriz com o ConstrutorMatriz, sem passar pelo Matriz::insert() a cada elemento.
+ */
+
+/**
+ * @brief Lê uma matriz no formato texto.
+ *
+ * @param caminho Caminho do arquivo.
+ * @param progresso Se informado, recebe periodicamente o percentual (0 a 100) do arquivo já lido.
+ * @return A matriz lida.
+ *
+ * @throws std::runtime_error Quando não é possível abrir o arquivo.
+ * @throws std::invalid_argument Se as dimensões ou alguma posição forem inválidas.
+ */
+Matriz lerMatrizTexto(const std::string &caminho, std::atomic<int> *progresso = nullptr);
+
+/**
+ * @brief Escreve uma matriz no formato texto, em ordem de linhas.
+ *
+ * @throws std::runtime_error Quando não é possível criar o arquivo.
+ */
+void escreverMatrizTexto(const Matriz &matriz, const std::string &caminho);
+
+/**
+ * @brief Lê uma matriz no formato binário.
+ *
+ * A quantidade de elementos do cabeçalho é conferida com o tamanho do arquivo antes de qualquer reserva de memória.
+ *
+ * @throws std::runtime_error Quando não é possível abrir o arquivo ou o conteúdo não está no formato esperado
+ *         (inclusive quando a quantidade de elementos não corresponde ao tamanho do arquivo).
+ */
+Matriz lerMatrizBinaria(const std::string &caminho);
+
+/**
+ * @brief Escreve uma matriz no formato binário.
+ *
+ * @throws std::runtime_error Quando não é possível criar o arquivo.
+ */
+void escreverMatrizBinaria(const Matriz &matriz, const std::string &caminho);
+
+/**
+ * @brief Lê uma matriz no formato Matrix Market.
+ *
+ * O conteúdo é dividido em blocos de linhas interpretados por threads distintas; os elementos
+ * de cada bloco são repassados ao ConstrutorMatriz, que também faz a expansão das matrizes
+ * "symmetric" (cada elemento fora da diagonal gera o seu simétrico). Em arquivos "pattern"
+ * todos os elementos recebem o valor 1.
+ *
+ * @param caminho Caminho do arquivo.
+ * @param threads Quantidade de threads; 0 escolhe automaticamente conforme o tamanho do arquivo
+ *                e os núcleos disponíveis.
+ * @return A matriz lida.
+ *
+ * @throws std::runtime_error Quando não é possível abrir o arquivo, o cabeçalho não é suportado
+ *                            alguma linha está malformada ou a quantidade declarada não cabe
+ *                            no arquivo.
+ * @throws std::invalid_argument Se as dimensões ou alguma posição forem inválidas.
+ */
+Matriz lerMatrizMM(const std::string &caminho, unsigned threads = 0);
+
+/**
+ * @brief Escreve uma matriz no formato Matrix Market "coordinate real".
+ *
+ * @param matriz Matriz a ser escrita.
+ * @param caminho Caminho do arquivo.
+ * @param simetrica Se verdadeiro, grava apenas o triângulo inferior com a simetria "symmetric".
+ *
+ * @throws std::runtime_error Quando não é possível criar o arquivo.
+ * @throws std::invalid_argument Se \p simetrica for pedido e a matriz não for simétrica.
+ */
+void escreverMatrizMM(const Matriz &matriz, const std::string &caminho, bool simetrica = false);
+
+/**
+ * @brief Codificação dos valores no formato compactado.
+ */
+enum class ValoresCompactados
+{
+    Automatico, /**< Inteiro se todos os valores forem inteiros, Dicionario se houver poucos valores distintos; caso contrário, Double. */
+    Double,     /**< Valores exatos em 8 bytes. */
+    Float,      /**< Valores reduzidos a float (4 bytes), com perda de precisão. */
+    Dicionario, /**< Tabela de valores distintos e um índice varint por elemento. */
+    Inteiro     /**< Valores inteiros em varint com zigue-zague (apenas para matrizes de valores inteiros). */
+};
+
+/**
+ * @brief Escreve uma matriz no formato compactado.
+ *
+ * Para cada linha não vazia são gravados, em varint, o salto desde a última linha gravada, a
+ * quantidade de elementos e as colunas como diferenças da coluna anterior. Como as colunas de
+ * uma linha são crescentes, as diferenças costumam caber em um ou dois bytes.
+ *
+ * @param matriz Matriz a ser escrita.
+ * @param caminho Caminho do arquivo.
+ * @param valores Codificação dos valores; apenas Float altera os valores gravados.
+ *
+ * @throws std::runtime_error Quando não é possível criar o arquivo.
+ * @throws std::invalid_argument Se Inteiro for pedido e algum valor não for inteiro.
+ */
+void escreverMatrizCompactada(const Matriz &matriz, const std::string &caminho, ValoresCompactados valores = ValoresCompactados::Automatico);
+
+/**
+ * @brief Lê uma matriz no formato compactado.
+ *
+ * O arquivo é decodificado em blocos, e cada elemento é repassado ao ConstrutorMatriz na ordem
+ * de linhas, sem carregar o arquivo inteiro na memória. As quantidades do arquivo (elementos e
+ * entradas do dicionário) são limitadas pelos bytes restantes antes de qualquer reserva de memória.
+ *
+ * @throws std::runtime_error Quando não é possível abrir o arquivo ou o conteúdo não está no formato esperado.
+ */
+Matriz lerMatrizCompactada(const std::string &caminho);
+
+/**
+ * @brief Lê uma matriz escolhendo o formato pela extensão do arquivo (.bin para binário, .mtx para
+ * Matrix Market, .mec para compactado, texto nos demais casos).
+ */
+Matriz lerMatriz(const std::string &caminho);
+
+/**
+ * @brief Lê uma matriz como lerMatriz(), mas detecta estrutura diagonal ou em faixas.
+ *
+ * Os elementos lidos são examinados antes de qualquer nó ser criado: se couberem em poucas
+ * diagonais (veja MatrizDiagonal::detectar()), a matriz é devolvida no formato DIA, em vetores
+ * contíguos; caso contrário, é montada normalmente como Matriz.
+ *
+ * @param caminho Caminho do arquivo (formato escolhido pela extensão).
+ * @param preenchimentoMinimo Fração mínima de elementos não nulos nas diagonais ocupadas.
+ *
+ * @note A detecção é feita apenas aqui. As cargas do menu interativo (lerMatrizTexto()) e do modo
+ *       lote (lerMatriz()) não a fazem, pois o RegistroMatrizes guarda somente Matriz: lá, uma matriz
+ *       diagonal ou em faixas continua encadeada. Ainda assim, multiply() reconhece um operando que
+ *       só ocupa a diagonal principal e reduz o produto a escalar linhas ou colunas.
+ */
+std::variant<Matriz, MatrizDiagonal> lerMatrizAdaptativa(const std::string &caminho, const double &preenchimentoMinimo = 0.5);
+
+/**
+ * @brief Escreve uma matriz escolhendo o formato pela extensão do arquivo (.bin para binário, .mtx
+ * para Matrix Market, .mec para compactado, texto nos demais casos).
+ */
+void escreverMatriz(const Matriz &matriz, const std::string &caminho);
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef LOTE_HPP
+#define LOTE_HPP
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+/**
+ * @file Lote.hpp
+ * @brief Modo não interativo (lote) do programa de matrizes esparsas.
+ *
+ * Executa uma sequência de passos informada pela linha de comando ou por um arquivo de script,
+ * sem menu, sem chamadas ao shell e sem impressão densa das matrizes. Cada passo é cronometrado
+ * e o tempo é exibido na saída, para que o programa possa ser usado em pipelines e agendadores.
+ *
+ * Passos aceitos (na linha de comando com o prefixo "--", no script sem ele):
+ * - load NOME=arquivo   Lê uma matriz (binária se terminar em .bin, Matrix Market se terminar em
+ *                       .mtx, compactada se terminar em .mec, texto nos demais casos).
+ * - save NOME=arquivo   Grava uma matriz, escolhendo o formato pela extensão como em load.
+ * - sum C=A,B           Soma as matrizes A e B e guarda o resultado em C.
+ * - mul C=A,B           Multiplica as matrizes A e B e guarda o resultado em C.
+ * - prune NOME=TOL[,K]  Remove da matriz os elementos com |v| < TOL e, com K, mantém apenas os
+ *                       K maiores |v| de cada linha (veja Matriz::prune()).
+ * - info NOME           Exibe as dimensões e a quantidade de elementos não nulos.
+ * - budget MIB          Limita a memória das matrizes guardadas: as menos usadas recentemente
+ *                       são despejadas para instantâneos em disco e recarregadas quando usadas.
+ * - script arquivo      Executa os passos do arquivo, um por linha; linhas vazias e iniciadas
+ *                       por '#' são ignoradas.
+ *
+ * Exemplo:
+ * @code
+ * Matriz-Esparsa --load A=m1.txt --load B=m2.txt --mul C=A,B --save C=out.bin
+ * @endcode
+ */
+
+/**
+ * @brief Executa os passos do modo lote.
+ *
+ * Todos os passos são validados antes da execução; a execução é interrompida no primeiro
+ * passo que falhar.
+ *
+ * @param argumentos Argumentos da linha de comando (sem o nome do programa).
+ * @param saida Fluxo onde o andamento e os tempos de cada passo são escritos.
+ * @return 0 em caso de sucesso; 1 se algum passo for inválido ou falhar (a mensagem de erro vai para std::cerr).
+ */
+int executarLote(const std::vector<std::string> &argumentos, std::ostream &saida);
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef CONSTRUTOR_MATRIZ_HPP
+#define CONSTRUTOR_MATRIZ_HPP
+
+#include <vector>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @brief Elemento (linha, coluna, valor) acumulado pelo ConstrutorMatriz.
+ */
+struct Tripla
+{
+    int linha;    /**< Linha do elemento (a partir de 1). */
+    int coluna;   /**< Coluna do elemento (a partir de 1). */
+    double valor; /**< Valor do elemento. */
+};
+
+/**
+ * @class ConstrutorMatriz
+ * @brief Construtor em lote de matrizes esparsas.
+ *
+ * Acumula os elementos em um vetor e monta a Matriz de uma só vez, ligando os nós em ordem
+ * de linha e de coluna. Enquanto cada Matriz::insert() precisa percorrer a linha e a coluna
+ * do novo elemento, o construtor liga todos os nós em O(nnz + linhas + colunas), após uma
+ * ordenação que é dispensada quando os elementos já chegam em ordem.
+ *
+ * @note
+ * - Valores iguais a zero são ignorados, como em Matriz::insert().
+ * - Se a mesma posição for adicionada mais de uma vez, prevalece o último valor,
+ *   reproduzindo o comportamento de inserções sucessivas.
+ */
+class ConstrutorMatriz
+{
+private:
+    int linhas;                   /**< Números de linhas da matriz a ser construída. */
+    int colunas;                  /**< Números de colunas da matriz a ser construída. */
+    std::vector<Tripla> entradas; /**< Elementos acumulados. */
+    bool ordenado;                /**< Indica se os elementos chegaram em ordem estrita de (linha, coluna). */
+
+public:
+    /**
+     * @brief Inicia a construção de uma matriz com as dimensões informadas.
+     *
+     * @throw std::invalid_argument Se @p lin ou @p col forem menores ou iguais a zero.
+     */
+    ConstrutorMatriz(const int &lin, const int &col);
+
+    /**
+     * @brief Reserva espaço para a quantidade esperada de elementos.
+     */
+    void reservar(const size_t &quantidade);
+
+    /**
+     * @brief Adiciona um elemento à matriz em construção.
+     *
+     * @throws std::invalid_argument Se (posI, posJ) estiver fora dos limites da matriz.
+     */
+    void adicionar(const int &posI, const int &posJ, const double &value);
+
+    /**
+     * @brief Adiciona um elemento e o seu simétrico (posJ, posI).
+     *
+     * Usado na expansão de matrizes armazenadas apenas por um triângulo (por exemplo, arquivos
+     * Matrix Market "symmetric"). Elementos da diagonal são adicionados uma única vez.
+     *
+     * @throws std::invalid_argument Se alguma das duas posições estiver fora dos limites da matriz.
+     */
+    void adicionarSimetrico(const int &posI, const int &posJ, const double &value);
+
+    /**
+     * @brief Retorna a quantidade de elementos acumulados até o momento.
+     */
+    size_t quantidade() const;
+
+    int getLinhas() const;
+    int getColunas() const;
+
+    /**
+     * @brief Elementos acumulados, na ordem de chegada (podem conter posições repetidas).
+     */
+    const std::vector<Tripla> &getEntradas() const;
+
+    /**
+     * @brief Monta a Matriz com todos os elementos acumulados.
+     *
+     * Após a chamada o construtor fica vazio e pode ser reutilizado para as mesmas dimensões.
+     *
+     * @param recurso Recurso de memória dos nós da matriz (veja Matriz::Matriz(int, int, std::pmr::memory_resource *)).
+     * @return A matriz construída.
+     */
+    Matriz construir(std::pmr::memory_resource *recurso = std::pmr::get_default_resource());
+};
+
+#endif
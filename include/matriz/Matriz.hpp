@@ -2,9 +2,125 @@
 #define MATRIZ_HPP
 
 #include <iostream>
+#include <vector>
+#include <memory>
+#include <memory_resource>
+#include <atomic>
+#include <optional>
+#include <cstdint>
 #include "node/Node.hpp"
 #include "IteratorM/IteratorM.hpp"
 
+struct TravasConcorrentes;
+struct ReordenacaoRCM;
+class VisaoMatriz;
+
+/**
+ * @brief Estrutura encadeada de uma Matriz: nó-cabeçalho, sentinelas e nós de dados.
+ *
+ * A estrutura é mantida por um ponteiro compartilhado (std::shared_ptr), de modo que cópias de
+ * uma Matriz passam a referenciar a mesma estrutura em O(1). Enquanto estiver compartilhada, ela
+ * é tratada como imutável: a primeira alteração feita por qualquer uma das matrizes cria antes
+ * uma cópia exclusiva (copy-on-write).
+ */
+struct EstruturaMatriz
+{
+    std::pmr::memory_resource *recurso; /**< Origem da memória de todos os nós (dados, sentinelas e cabeçalho). */
+    Node *cabecalho; /**< Nó-cabeçalho da matriz. */
+    int linhas;      /**< Números de linhas. */
+    int colunas;     /**< Números de colunas. */
+
+    std::vector<Node *> sentinelasLinha;  /**< Acesso direto aos sentinelas de linha (posição 0 é o cabeçalho). */
+    std::vector<Node *> sentinelasColuna; /**< Acesso direto aos sentinelas de coluna (posição 0 é o cabeçalho). */
+
+    const uint64_t identidade;                       /**< Número único da estrutura no processo (não é reaproveitado). */
+    std::atomic<uint64_t> versao{0};                 /**< Avança a cada alteração (veja Matriz::getVersao()). */
+
+    std::atomic<size_t> elementos{0};                /**< Quantidade total de nós de dados. */
+    std::vector<std::atomic<int>> elementosLinha;    /**< Nós de dados de cada linha (posição 0 sem uso). */
+    std::vector<std::atomic<int>> elementosColuna;   /**< Nós de dados de cada coluna (posição 0 sem uso). */
+
+    /**
+     * @brief Cria o nó-cabeçalho e as listas circulares de sentinelas de linhas e de colunas.
+     *
+     * Cada nó de linha aponta para si mesmo à direita, e cada nó de coluna aponta para si mesmo
+     * abaixo. Com @p lin e @p col iguais a zero, apenas o cabeçalho é criado. Todos os nós
+     * são obtidos de @p recurso.
+     */
+    EstruturaMatriz(const int &lin, const int &col, std::pmr::memory_resource *recurso);
+
+    EstruturaMatriz(const EstruturaMatriz &) = delete;
+    EstruturaMatriz &operator=(const EstruturaMatriz &) = delete;
+
+    /**
+     * @brief Desaloca todos os nós de dados, os sentinelas e o cabeçalho.
+     *
+     * @details
+     * - Remove os nós de dados com limpar().
+     * - Percorre os sentinelas de linha a partir do cabeçalho (abaixo) e os desaloca.
+     * - Percorre os sentinelas de coluna a partir do cabeçalho (direita) e os desaloca.
+     * - Por fim, desaloca o cabeçalho.
+     */
+    ~EstruturaMatriz();
+
+    /**
+     * @brief Remove todos os nós de dados, restaurando os sentinelas para que apontem para si mesmos.
+     */
+    void limpar();
+
+    /**
+     * @brief Aloca e constrói um nó no recurso de memória da estrutura.
+     */
+    Node *criarNo(const int &linha, const int &coluna, const double &valor)
+    {
+        return new (recurso->allocate(sizeof(Node), alignof(Node))) Node(linha, coluna, valor);
+    }
+
+    /**
+     * @brief Devolve ao recurso de memória um nó criado por criarNo() (Node não tem destrutor a chamar).
+     */
+    void liberarNo(Node *no)
+    {
+        recurso->deallocate(no, sizeof(Node), alignof(Node));
+    }
+
+    /**
+     * @brief Atualiza os contadores após ligar um nó de dados em (linha, coluna).
+     *
+     * Os contadores são atômicos: no modo concorrente, escritores de linhas diferentes podem
+     * atualizar o total (e colunas compartilhadas) ao mesmo tempo.
+     */
+    void registrarNo(const int &linha, const int &coluna)
+    {
+        elementos.fetch_add(1, std::memory_order_relaxed);
+        elementosLinha[linha].fetch_add(1, std::memory_order_relaxed);
+        elementosColuna[coluna].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Atualiza os contadores após desligar o nó de dados em (linha, coluna).
+     */
+    void descontarNo(const int &linha, const int &coluna)
+    {
+        elementos.fetch_sub(1, std::memory_order_relaxed);
+        elementosLinha[linha].fetch_sub(1, std::memory_order_relaxed);
+        elementosColuna[coluna].fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Primeira posição em que duas matrizes diferem (veja Matriz::primeiraDiferenca()).
+ *
+ * Se as dimensões forem diferentes, linha e coluna valem 0.
+ */
+struct DiferencaMatriz
+{
+    int linha{0};        /**< Linha da diferença (a partir de 1). */
+    int coluna{0};       /**< Coluna da diferença (a partir de 1). */
+    double valorA{0.0};  /**< Valor nesta matriz (0 se não armazenado). */
+    double valorB{0.0};  /**< Valor na outra matriz (0 se não armazenado). */
+};
+
 /**
  * @class Matriz
  * @brief Classe que representa uma matriz esparsa.
@@ -24,6 +140,8 @@
  * - A matriz é inicializada com um nó-cabeçalho que aponta para si mesmo.
  * - Os índices das linhas e colunas começam em 1.
  * - A inserção de elementos é feita apenas em posições válidas (dentro dos limites da matriz).
+ * - Cópias compartilham a mesma EstruturaMatriz até que uma delas seja alterada (copy-on-write),
+ *   o que torna copiar, atribuir e armazenar matrizes em contêineres uma operação O(1).
  *
  * @warning
  * - A tentativa de acessar ou inserir elementos em posições inválidas (fora dos limites da matriz)
@@ -31,10 +149,30 @@
  */
 class Matriz
 {
+    friend class ConstrutorMatriz;
+    friend class ProdutoEsparso;
+
 private:
-    Node *cabecalho; /**< Nó-cabeçalho da matriz. */
-    int linhas;      /**< Números de linhas. */
-    int colunas;     /**< Números de colunas. */
+    std::shared_ptr<EstruturaMatriz> estrutura; /**< Estrutura encadeada, possivelmente compartilhada com cópias. */
+
+    std::unique_ptr<TravasConcorrentes> travas; /**< Travas por faixa de linhas/colunas; nulo fora do modo concorrente. */
+
+    /**
+     * @brief Garante que a estrutura encadeada pertence apenas a esta matriz.
+     *
+     * Se a estrutura estiver compartilhada com outras cópias, cria uma cópia profunda exclusiva,
+     * ligando os nós linha a linha em O(nnz + linhas + colunas). Deve ser chamada por todo método
+     * que altere a estrutura ou exponha referências mutáveis aos valores. A versão não muda: uma
+     * estrutura recém-separada já tem identidade própria.
+     */
+    void separar();
+
+    /**
+     * @brief Separa a estrutura (separar()) e avança a sua versão (getVersao()).
+     *
+     * Chamada pelos métodos que alteram de fato os valores ou a estrutura, antes da alteração.
+     */
+    void alterar();
 
 public:
     /**
@@ -69,23 +207,28 @@ public:
      * abaixo, formando estruturas circulares independentes para linhas e colunas, todas centralizadas
      * no nó-cabeçalho.
      *
+     * Todos os nós (cabeçalho, sentinelas e dados) são alocados em @p recurso, que pode ser uma arena,
+     * um pool ou um RecursoMonitorado. O recurso precisa existir enquanto a matriz ou qualquer cópia
+     * dela existir; as cópias separadas pelo copy-on-write usam o mesmo recurso.
+     *
      * @param lin Quantidade de linhas da matriz (deve ser um valor maior que zero).
      * @param col Quantidade de colunas da matriz (deve ser um valor maior que zero).
+     * @param recurso Recurso de memória dos nós; por padrão, o recurso padrão de std::pmr (new/delete).
      *
-     * @throw std::invalid_argument Exceção lançada quando lin ou col são menores ou iguais a zero.
+     * @throw std::invalid_argument Exceção lançada quando lin ou col são menores ou iguais a zero, ou quando
+     *        o recurso é nulo.
      */
-    Matriz(const int &ln, const int &cl);
+    Matriz(const int &ln, const int &cl, std::pmr::memory_resource *recurso = std::pmr::get_default_resource());
 
     /**
      * @brief Construtor de cópia para a classe Matriz.
      *
-     * Este construtor cria uma nova instância de Matriz a partir de outra instância existente, realizando uma cópia profunda dos
-     * elementos da matriz original. Inicialmente, ele chama o construtor principal da classe, passando como argumentos o número
-     * de linhas e colunas da matriz a ser copiada, garantindo que a nova matriz possua a mesma estrutura de armazenamento.
+     * A nova matriz passa a compartilhar a estrutura encadeada da matriz original, apenas incrementando o
+     * contador de referências do std::shared_ptr, em O(1) de tempo e memória. A cópia profunda dos nós é
+     * adiada até que uma das matrizes seja alterada (ver separar()).
      *
-     * Após a alocação da estrutura adequada, o construtor itera por todos os elementos da matriz original ("outra") usando um
-     * iterador (IteratorM). Para cada elemento encontrado, o método insert é invocado para inserir o valor na nova matriz,
-     * mantendo a posição indicada pelos atributos "linha" e "coluna" presentes na estrutura apontada pelo iterador.
+     * @note Se a matriz original estiver no modo concorrente, a cópia é feita imediatamente, pois
+     *       escritores concorrentes não podem disputar a separação de uma estrutura compartilhada.
      *
      * @param outra Referência para a instância da matriz que será copiada.
      */
@@ -94,25 +237,8 @@ public:
     /**
      * @brief Destrutor da classe Matriz.
      *
-     * Este destrutor é responsável por desalocar toda a memória alocada pela matriz esparsa, incluindo os nós de dados e os nós sentinela.
-     *
-     * @details
-     * A operação é realizada em várias etapas para evitar vazamento de memória e acessos inválidos:
-     *
-     *    - Verifica se o nó cabeçalho é nulo. Se for, a matriz está vazia e não há nada a ser desalocado
-     *
-     *    - Inicia a partir do primeiro nó sentinela abaixo do cabeçalho e, enquanto não retorna para o cabeçalho,
-     *      desaloca cada nó.
-     *
-     *    - Inicia a partir do primeiro nó sentinela à direita do cabeçalho e, seguindo até retornar ao cabeçalho,
-     *      desaloca cada nó.
-     *
-     *    - Após remover todos os nós sentinela nas linhas e colunas, o cabeçalho é removido.
-     *
-     *    - O ponteiro do cabeçalho é então definido como nullptr para evitar acessos inválidos posteriores.
-     *
-     * @note Este método garante que todos os nós foram corretamente liberados, evitando vazamentos de memória e a
-     *       tentativa de desalocar a mesma memória mais de uma vez.
+     * Libera a referência para a estrutura encadeada. Os nós de dados, os sentinelas e o cabeçalho são
+     * desalocados pelo destrutor de EstruturaMatriz quando a última matriz que a compartilha é destruída.
      */
     ~Matriz();
 
@@ -129,6 +255,10 @@ public:
      *
      * @note Esse método presume que a matriz está devidamente inicializada e que o cabeçalho
      *       aponta para posicionamentos válidos da estrutura.
+     * @note Como o iterador permite alterar os valores, a estrutura é separada de eventuais cópias
+     *       antes de ser percorrida; a versão só avança quando um valor é escrito pelo iterador.
+     *       Copiar a matriz invalida os iteradores mutáveis já obtidos (veja IteratorM). Para apenas
+     *       ler, prefira a versão const, que não separa a estrutura.
      */
     IteratorM begin();
 
@@ -140,6 +270,8 @@ public:
      * ao final da estrutura de dados.
      *
      * @return IteratorM Objeto iterador apontando para o final da matriz.
+     *
+     * @note Assim como begin(), separa a estrutura de eventuais cópias.
      */
     IteratorM end();
 
@@ -150,10 +282,10 @@ public:
      * para o primeiro nó principal da matriz esparsa, sem permitir alterações nos
      * valores da matriz. O iterador retornado aponta para o primeiro nó relevante
      *
-     * @return IteratorM Objeto iterador apontando para o início da matriz.
+     * @return ConstIteratorM Objeto iterador, somente leitura, apontando para o início da matriz.
      *
      */
-    IteratorM begin() const;
+    ConstIteratorM begin() const;
 
     /**
      * @brief Iterador que aponta para o final da matriz (versão const).
@@ -162,9 +294,9 @@ public:
      * para o final da matriz esparsa, sem permitir alterações nos valores da matriz.
      * O iterador retornado aponta para o final da estrutura de dados.
      *
-     * @return IteratorM Objeto iterador apontando para o final da matriz.
+     * @return ConstIteratorM Objeto iterador, somente leitura, apontando para o final da matriz.
      */
-    IteratorM end() const;
+    ConstIteratorM end() const;
 
     /**
      * @brief Sobrecarga do operador de atribuição para a classe Matriz.
@@ -178,16 +310,18 @@ public:
      * @param matriz Objeto do tipo Matriz que contém os novos dados a serem atribuídos. Por ser passado por valor, uma cópia
      * dos dados é criada, permitindo que a operação de troca seja efetuada sem riscos de perda de recursos em caso de erros.
      *
-     * @return Retorna o próprio objeto (*this) já contendo os dados do objeto 'matriz'. O retorno por valor, nesse contexto,
-     * assegura que o objeto resultante possui os recursos de forma consistente.
+     * @return Retorna uma referência para o próprio objeto (*this) já contendo os dados do objeto 'matriz'. Retornar por
+     * referência evita uma cópia a mais, que no modo concorrente seria profunda.
      *
      * @details
-     * - std::swap: São trocados os atributos 'cabecalho', 'linhas' e 'colunas' entre o objeto atual e o objeto recebido,
-     *   o que permite que o estado do objeto atual seja atualizado com o novo conteúdo.
+     * - std::swap: É trocada apenas a estrutura encadeada entre o objeto atual e o objeto recebido. As travas do modo
+     *   concorrente pertencem ao objeto atual e são mantidas: uma matriz concorrente continua concorrente após receber
+     *   outra. Como a cópia do parâmetro apenas compartilha a estrutura, a atribuição custa O(1); no modo concorrente,
+     *   a estrutura recebida é separada de imediato, como no construtor de cópia.
      * - Ao final da função, o objeto local 'matriz' é destruído, liberando os recursos que anteriormente pertenciam ao objeto
      *   atual, evitando assim possíveis vazamentos de memória.
      */
-    Matriz operator=(Matriz matriz);
+    Matriz &operator=(Matriz matriz);
 
     /**
      * @brief Retorna a quantidade de linhas da matriz.
@@ -209,6 +343,34 @@ public:
      */
     int getColunas() const;
 
+    /**
+     * @brief Retorna o nó sentinela de uma linha da matriz.
+     *
+     * O sentinela é o início da lista circular horizontal da linha: os nós de dados
+     * são percorridos a partir de `sentinela->direita` até voltar ao próprio sentinela,
+     * em ordem crescente de coluna. O acesso é feito em O(1), sem percorrer os demais
+     * sentinelas a partir do cabeçalho.
+     *
+     * @param posI Índice da linha (deve estar no intervalo [1, linhas]).
+     * @return Ponteiro constante para o sentinela da linha.
+     *
+     * @throw std::invalid_argument Se @p posI estiver fora dos limites da matriz.
+     */
+    const Node *getSentinelaLinha(const int &posI) const;
+
+    /**
+     * @brief Retorna o nó sentinela de uma coluna da matriz.
+     *
+     * Semelhante a getSentinelaLinha(), mas para a lista circular vertical: os nós de dados
+     * são percorridos a partir de `sentinela->abaixo`, em ordem crescente de linha.
+     *
+     * @param posJ Índice da coluna (deve estar no intervalo [1, colunas]).
+     * @return Ponteiro constante para o sentinela da coluna.
+     *
+     * @throw std::invalid_argument Se @p posJ estiver fora dos limites da matriz.
+     */
+    const Node *getSentinelaColuna(const int &posJ) const;
+
     /**
      * @brief Limpa os dados armazenados na matriz esparsa.
      *
@@ -236,9 +398,57 @@ public:
      * @note
      * - A função somente remove os nós de dados e restaura os ponteiros dos sentinelas, mantendo o nó cabeçalho intacto.
      * - A estrutura original da matriz esparsa é preservada, permitindo que a mesma seja reutilizada posteriormente.
+     * - Se a estrutura estiver compartilhada com cópias, esta matriz apenas passa a usar uma nova estrutura vazia,
+     *   sem copiar os nós que seriam removidos.
      */
     void limpar();
 
+    /**
+     * @brief Habilita o modo concorrente de escrita da matriz.
+     *
+     * Uma inserção só altera uma lista de linha e uma lista de coluna. No modo concorrente, cada
+     * linha e cada coluna é associada a uma de @p faixas travas (índice módulo @p faixas), e
+     * insert()/erase() adquirem apenas a trava da faixa da linha e, em seguida, a da faixa da
+     * coluna. Como a ordem de aquisição é sempre linha -> coluna, não há espera circular, e
+     * escritores em linhas e colunas de faixas diferentes avançam em paralelo.
+     *
+     * @param faixas Quantidade de travas para linhas e para colunas (deve ser maior que zero).
+     *
+     * @throw std::invalid_argument Se @p faixas for igual a zero.
+     *
+     * @note
+     * - get() também adquire a trava da linha, podendo ser chamado junto com escritores.
+     * - Percursos completos (iteradores, print(), cópias, limpar()) não são protegidos e devem
+     *   ocorrer apenas quando não houver escritores ativos.
+     * - Habilitar ou desabilitar o modo não pode ocorrer em paralelo com outras operações.
+     * - Escritores de linhas diferentes alocam nós ao mesmo tempo: o recurso de memória da matriz
+     *   precisa ser seguro entre threads (o recurso padrão é; o RecursoMonitorado é quando a sua
+     *   origem for; std::pmr::monotonic_buffer_resource não é).
+     */
+    void habilitarConcorrencia(const size_t &faixas = 64);
+
+    /**
+     * @brief Desabilita o modo concorrente, liberando as travas.
+     */
+    void desabilitarConcorrencia();
+
+    /**
+     * @brief Indica se o modo concorrente de escrita está habilitado.
+     */
+    bool concorrente() const;
+
+    /**
+     * @brief Verifica a integridade das listas encadeadas da matriz.
+     *
+     * Confere que cada lista de linha está em ordem estritamente crescente de coluna e contém apenas
+     * nós da própria linha, que cada lista de coluna está em ordem estritamente crescente de linha e
+     * contém apenas nós da própria coluna, e que ambas as visões possuem a mesma quantidade de nós,
+     * igual à registrada nos contadores de cada linha, de cada coluna e no total.
+     *
+     * @return true se a estrutura estiver consistente, false caso contrário.
+     */
+    bool verificarIntegridade() const;
+
     /**
      * @brief Insere um valor em uma posição específica da matriz esparsa.
      *
@@ -271,6 +481,279 @@ public:
      */
     void insert(const int &posI, const int &posJ, const double &value);
 
+    /**
+     * @brief Remove o elemento armazenado em uma posição específica da matriz esparsa.
+     *
+     * O nó é desligado tanto da lista horizontal da linha quanto da lista vertical da coluna
+     * e então desalocado. Caso a posição não possua valor armazenado, nada é feito: a estrutura não é
+     * separada de eventuais cópias e a versão (getVersao()) não muda.
+     *
+     * @param posI Índice da linha (deve estar no intervalo [1, linhas]).
+     * @param posJ Índice da coluna (deve estar no intervalo [1, colunas]).
+     * @return true se um elemento foi removido, false caso a posição já estivesse vazia.
+     *
+     * @throws std::invalid_argument Se @p posI ou @p posJ estiverem fora dos limites da matriz.
+     */
+    bool erase(const int &posI, const int &posJ);
+
+    /**
+     * @brief Soma, no lugar, um múltiplo de outra matriz: A += alfa * B.
+     *
+     * As linhas de B são intercaladas com as linhas de A: posições coincidentes reaproveitam o nó
+     * de A, posições novas recebem um nó ligado na linha e na coluna, e elementos que se anulam
+     * são removidos. Apenas as linhas não vazias de B são percorridas; nas colunas, a posição de
+     * ligação avança de forma monótona, pois as linhas são tratadas em ordem crescente.
+     *
+     * @param alfa Escalar que multiplica \p matrizB.
+     * @param matrizB Matriz com as mesmas dimensões desta.
+     * @return Referência para esta matriz.
+     *
+     * @throws std::invalid_argument Se as matrizes não possuírem o mesmo tamanho.
+     */
+    Matriz &adicionarEscalado(const double &alfa, const Matriz &matrizB);
+
+    /**
+     * @brief Soma, no lugar, outra matriz a esta (equivale a adicionarEscalado(1, matrizB)).
+     *
+     * @throws std::invalid_argument Se as matrizes não possuírem o mesmo tamanho.
+     */
+    Matriz &operator+=(const Matriz &matrizB);
+
+    /**
+     * @brief Subtrai, no lugar, outra matriz desta (equivale a adicionarEscalado(-1, matrizB)).
+     *
+     * @throws std::invalid_argument Se as matrizes não possuírem o mesmo tamanho.
+     */
+    Matriz &operator-=(const Matriz &matrizB);
+
+    /**
+     * @brief Multiplica, no lugar, todos os elementos por um escalar.
+     *
+     * Multiplicar por zero esvazia a matriz, como limpar().
+     */
+    Matriz &operator*=(const double &alfa);
+
+    /**
+     * @brief Produto de Hadamard (elemento a elemento) no lugar: A(i, j) *= B(i, j).
+     *
+     * Elementos de A sem correspondente em B, ou cujo produto resulte em zero, são removidos.
+     *
+     * @throws std::invalid_argument Se as matrizes não possuírem o mesmo tamanho.
+     */
+    Matriz &hadamard(const Matriz &matrizB);
+
+    /**
+     * @brief Esparsifica a matriz no lugar, removendo os elementos pequenos e os zeros armazenados.
+     *
+     * Remove os elementos com |v| < tolerancia e, se \p maximoPorLinha for positivo, mantém apenas os
+     * maximoPorLinha maiores |v| de cada linha (empates favorecem as colunas menores). Cada linha é
+     * percorrida uma vez e os nós removidos são desligados das colunas sem novas buscas, em
+     * O(nnz + linhas + colunas). Pode ser usada como gancho de poda de power() (OpcoesPotencia::poda).
+     *
+     * @return Quantidade de elementos removidos.
+     *
+     * @throws std::invalid_argument Se a tolerância for negativa.
+     */
+    size_t prune(const double &tolerancia, const size_t &maximoPorLinha = 0);
+
+    /**
+     * @brief Procura a primeira posição, em ordem de linhas, em que as matrizes diferem além da tolerância.
+     *
+     * As linhas das duas matrizes são intercaladas como listas ordenadas, em O(nnzA + nnzB + linhas);
+     * posições ausentes valem 0. Os valores a e b são considerados iguais quando
+     * |a - b| <= atol + rtol * max(|a|, |b|).
+     *
+     * @param outra Matriz comparada.
+     * @param rtol Tolerância relativa.
+     * @param atol Tolerância absoluta.
+     * @return A primeira diferença, ou std::nullopt se as matrizes forem iguais dentro da tolerância.
+     */
+    std::optional<DiferencaMatriz> primeiraDiferenca(const Matriz &outra, const double &rtol = 0.0, const double &atol = 0.0) const;
+
+    /**
+     * @brief Igualdade exata: mesmas dimensões e os mesmos valores em todas as posições.
+     *
+     * Cópias que ainda compartilham a estrutura são iguais em O(1). Um zero armazenado (por exemplo,
+     * por um ProdutoEsparso) é igual a uma posição vazia.
+     */
+    bool operator==(const Matriz &outra) const;
+
+    /**
+     * @brief Igualdade aproximada, com a mesma regra de primeiraDiferenca().
+     *
+     * @param diferenca Se informado e as matrizes diferirem, recebe a primeira posição diferente.
+     */
+    bool approxEqual(const Matriz &outra, const double &rtol = 1e-9, const double &atol = 0.0, DiferencaMatriz *diferenca = nullptr) const;
+
+    /**
+     * @brief Retorna a quantidade de elementos não nulos armazenados, em O(1).
+     *
+     * O contador é mantido por insert(), erase(), limpar(), pelas operações no lugar e pelo
+     * ConstrutorMatriz, de modo que não é preciso percorrer a matriz.
+     */
+    size_t quantidade() const;
+
+    /**
+     * @brief Retorna a quantidade de elementos armazenados na linha, em O(1).
+     *
+     * @throws std::invalid_argument Se @p posI estiver fora dos limites da matriz.
+     */
+    int quantidadeLinha(const int &posI) const;
+
+    /**
+     * @brief Retorna a quantidade de elementos armazenados na coluna, em O(1).
+     *
+     * @throws std::invalid_argument Se @p posJ estiver fora dos limites da matriz.
+     */
+    int quantidadeColuna(const int &posJ) const;
+
+    /**
+     * @brief Fração das posições que guardam um elemento: quantidade() / (linhas * colunas).
+     */
+    double densidade() const;
+
+    /**
+     * @brief Estimativa, em bytes, da memória ocupada pela estrutura encadeada.
+     *
+     * Soma os nós de dados, os sentinelas, o cabeçalho, os vetores de acesso direto e de contadores
+     * e os objetos Matriz/EstruturaMatriz. Não inclui a sobrecarga do alocador.
+     * Uma estrutura compartilhada por cópias é contada integralmente em cada uma delas.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Retorna o recurso de memória de onde vêm os nós desta matriz.
+     *
+     * applyPermutation() e reorderRCM() criam o resultado no mesmo recurso; as funções livres que
+     * criam matrizes novas (sum(), multiply(), ...) usam sempre o recurso padrão, qualquer que seja
+     * o recurso dos operandos.
+     */
+    std::pmr::memory_resource *getRecurso() const;
+
+    /**
+     * @brief Retorna o número único da estrutura encadeada usada por esta matriz.
+     *
+     * Cópias que compartilham a estrutura têm a mesma identidade; a separação do copy-on-write e
+     * limpar() de uma estrutura compartilhada dão à matriz uma identidade nova. Identidades não são
+     * reaproveitadas, mesmo depois que a estrutura é destruída.
+     */
+    uint64_t getIdentidade() const;
+
+    /**
+     * @brief Retorna a versão da estrutura, que avança a cada alteração.
+     *
+     * insert(), erase(), limpar(), prune(), as operações no lugar, as escritas por um IteratorM e
+     * ProdutoEsparso::calcular() avançam a versão, mesmo quando nada muda de fato; a exceção é erase()
+     * de uma posição vazia, que não altera nada. Apenas obter ou percorrer iteradores não altera a
+     * versão. O par (getIdentidade(), getVersao()) identifica o conteúdo da matriz, o que
+     * permite guardar resultados calculados a partir dela (veja CacheResultados).
+     */
+    uint64_t getVersao() const;
+
+    /**
+     * @brief Retorna a matriz com linhas e colunas permutadas: B(i, j) = A(permLinhas[i - 1], permColunas[j - 1]).
+     *
+     * Percorre as colunas de A na nova ordem, o que já entrega cada nova linha com as colunas em
+     * ordem crescente, e depois percorre as novas linhas para ligar as colunas: O(nnz + linhas + colunas),
+     * sem ordenação.
+     *
+     * @param permLinhas Nova ordem das linhas (índices a partir de 1); vazio mantém a ordem atual.
+     * @param permColunas Nova ordem das colunas (índices a partir de 1); vazio mantém a ordem atual.
+     *
+     * @throws std::invalid_argument Se algum vetor não for uma permutação de 1..linhas (ou 1..colunas).
+     */
+    Matriz applyPermutation(const std::vector<int> &permLinhas, const std::vector<int> &permColunas) const;
+
+    /**
+     * @brief Reordenação Reverse Cuthill-McKee, que aproxima os elementos da diagonal.
+     *
+     * Trabalha sobre o grafo da estrutura simetrizada (vizinhos de v são as colunas da linha v e as
+     * linhas da coluna v). Em cada componente, a busca em largura parte de um vértice pseudo-periférico
+     * e visita os vizinhos em ordem crescente de grau; a ordem final é invertida. A mesma permutação é
+     * aplicada às linhas e às colunas.
+     *
+     * @return A permutação e a matriz permutada.
+     *
+     * @throws std::invalid_argument Se a matriz não for quadrada.
+     */
+    ReordenacaoRCM reorderRCM() const;
+
+    /**
+     * @brief Visão do bloco [linhaInicial, linhaFinal] x [colunaInicial, colunaFinal], sem copiar os elementos.
+     *
+     * A visão compartilha a estrutura desta matriz (veja VisaoMatriz) e pode ser usada em sum(),
+     * multiply(), no produto matriz-vetor e em print(); materialize() cria uma cópia independente.
+     *
+     * @throws std::invalid_argument Se a faixa for vazia ou sair dos limites da matriz.
+     */
+    VisaoMatriz view(const int &linhaInicial, const int &linhaFinal, const int &colunaInicial, const int &colunaFinal) const;
+
+    /**
+     * @brief Largura de banda: maior |i - j| entre os elementos armazenados.
+     */
+    int larguraBanda() const;
+
+    /**
+     * @brief Perfil (envelope): soma, em cada linha i, de i - j para a primeira coluna j < i armazenada.
+     */
+    size_t perfil() const;
+
+    /**
+     * @brief Soma de cada linha: a posição i - 1 recebe a soma da linha i.
+     *
+     * As reduções percorrem cada lista (linhas pelas ligações à direita, colunas pelas ligações abaixo)
+     * uma única vez. As listas são divididas em faixas contíguas com aproximadamente a mesma quantidade
+     * de elementos, uma por thread, e cada lista é somada por soma pareada (pairwise), com erro de
+     * arredondamento O(log n) em vez de O(n). Os totais escalares combinam os resultados das listas
+     * também por soma pareada, em ordem fixa: o resultado é o mesmo para qualquer quantidade de threads.
+     *
+     * No modo concorrente, todas as travas são mantidas durante a redução.
+     *
+     * @param threads Quantidade de threads (0 escolhe automaticamente; matrizes pequenas usam uma só).
+     */
+    std::vector<double> somaLinhas(unsigned threads = 0) const;
+
+    /**
+     * @brief Soma de cada coluna: a posição j - 1 recebe a soma da coluna j (veja somaLinhas()).
+     */
+    std::vector<double> somaColunas(unsigned threads = 0) const;
+
+    /**
+     * @brief Norma 1: maior soma dos valores absolutos de uma coluna (veja somaLinhas()).
+     */
+    double norma1(unsigned threads = 0) const;
+
+    /**
+     * @brief Norma infinito: maior soma dos valores absolutos de uma linha (veja somaLinhas()).
+     */
+    double normaInfinito(unsigned threads = 0) const;
+
+    /**
+     * @brief Norma de Frobenius: raiz da soma dos quadrados de todos os elementos (veja somaLinhas()).
+     */
+    double normaFrobenius(unsigned threads = 0) const;
+
+    /**
+     * @brief Traço: soma pareada da diagonal principal.
+     *
+     * @throws std::invalid_argument Se a matriz não for quadrada.
+     */
+    double traco() const;
+
+    /**
+     * @brief Menor valor da matriz, considerando as posições não armazenadas como zero (veja somaLinhas()).
+     *
+     * @return O menor valor; 0 para a matriz sem linhas.
+     */
+    double minimo(unsigned threads = 0) const;
+
+    /**
+     * @brief Maior valor da matriz, considerando as posições não armazenadas como zero (veja somaLinhas()).
+     *
+     * @return O maior valor; 0 para a matriz sem linhas.
+     */
+    double maximo(unsigned threads = 0) const;
+
     /**
      * @brief Retorna o valor armazenado em uma posição específica da matriz esparsa.
      *
@@ -278,9 +761,9 @@ public:
      * a convenção onde o primeiro índice é 1 e o último corresponde ao número total de linhas ou colunas da matriz.
      *
      * @details
-     * A função utiliza um iterador para percorrer a matriz, comparando as posições dos nós com os índices informados.
-     * Se o nó correspondente à posição ( @p posI, @p posJ) for encontrado, a função retorna o valor armazenado nele. Caso contrário,
-     * a função retornará 0, indicando que não há valor armazenado na posição informada.
+     * A função acessa diretamente o sentinela da linha @p posI e percorre apenas essa linha, comparando as colunas dos nós
+     * com o índice informado. Se o nó correspondente à posição ( @p posI, @p posJ) for encontrado, a função retorna o valor
+     * armazenado nele. Caso contrário, a função retornará 0, indicando que não há valor armazenado na posição informada.
      *
      * @param posI Constante que referencia o índice da linha desejada (deve estar no intervalo [1, linhas]).
      * @param posJ Constante que referencia o índice da coluna desejada (deve estar no intervalo [1, colunas]).
@@ -319,7 +802,23 @@ public:
      * armazenados. Para posições onde não há valor armazenado (na forma
      * esparsa), é imprimido o número 0.
      */
-    void print();
+    void print() const;
+
+    /**
+     * @brief Indica se a estrutura encadeada está compartilhada com outras cópias.
+     *
+     * @return true se outra Matriz referencia a mesma estrutura (a próxima alteração fará a cópia).
+     */
+    bool compartilhada() const;
+};
+
+/**
+ * @brief Resultado de Matriz::reorderRCM().
+ */
+struct ReordenacaoRCM
+{
+    std::vector<int> permutacao; /**< permutacao[k - 1] é o índice original que passa a ser o índice k. */
+    Matriz matriz;               /**< Matriz com linhas e colunas permutadas. */
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef PODA_HPP
+#define PODA_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Critérios de esparsificação de Matriz::prune() e das multiplicações (multiply(A, B, opcoes)).
+ *
+ * Zeros armazenados são sempre removidos. Os dois critérios podem ser combinados: a tolerância é
+ * aplicada primeiro e o limite por linha escolhe entre os elementos que restaram.
+ */
+struct OpcoesPoda
+{
+    double tolerancia{0.0};  /**< Remove os elementos com |v| < tolerancia (0 mantém todos os não nulos). */
+    size_t maximoPorLinha{0}; /**< Mantém apenas os maximoPorLinha maiores |v| de cada linha (0 sem limite). */
+
+    /**
+     * @brief Indica se algum critério está ativo.
+     */
+    bool ativa() const
+    {
+        return tolerancia > 0 || maximoPorLinha > 0;
+    }
+};
+
+/**
+ * @class PodaLinha
+ * @brief Decide quais elementos de uma linha sobrevivem aos critérios de OpcoesPoda.
+ *
+ * O construtor encontra, com std::nth_element, o limiar do maximoPorLinha-ésimo maior |v| em
+ * O(elementos da linha). Em seguida, manter() deve ser chamada para cada elemento em ordem
+ * crescente de coluna: empates no limiar são resolvidos a favor das colunas menores, o que torna
+ * o resultado determinístico.
+ */
+class PodaLinha
+{
+private:
+    double tolerancia;    /**< Tolerância de OpcoesPoda. */
+    bool limitada{false}; /**< A linha tem mais elementos do que maximoPorLinha. */
+    double limiar{0.0};   /**< Menor |v| mantido quando limitada. */
+    size_t empates{0};    /**< Quantos elementos com |v| == limiar ainda podem ser mantidos. */
+
+public:
+    /**
+     * @param opcoes Critérios da poda.
+     * @param valores Valores da linha, em qualquer ordem; o vetor é usado como área de trabalho.
+     */
+    PodaLinha(const OpcoesPoda &opcoes, std::vector<double> &valores);
+
+    /**
+     * @brief Indica se o elemento de valor \p valor é mantido (chamar em ordem crescente de coluna).
+     */
+    bool manter(const double &valor);
+};
+
+#endif
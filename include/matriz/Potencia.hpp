@@ -0,0 +1,47 @@
+#ifndef POTENCIA_HPP
+#define POTENCIA_HPP
+
+#include <functional>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @brief Opções de power().
+ */
+struct OpcoesPotencia
+{
+    /**
+     * @brief Quantidade de elementos acima da qual poda é chamada (0 desativa a poda).
+     */
+    size_t limiteElementos{0};
+
+    /**
+     * @brief Gancho de poda, chamado com cada produto intermediário que ultrapassar limiteElementos.
+     *
+     * Pode remover elementos (por exemplo, valores pequenos) para conter o crescimento das potências.
+     */
+    std::function<void(Matriz &)> poda;
+};
+
+/**
+ * @brief Calcula A^k por quadrados sucessivos.
+ *
+ * São feitos O(log k) produtos esparsos, todos com a mesma área de trabalho (EspacoProduto).
+ * Quando o quadrado de uma potência mantém o padrão de esparsidade da anterior, os quadrados
+ * seguintes passam a usar dois ProdutoEsparso alternados: a estrutura de cada um é alocada uma
+ * única vez, e os próximos quadrados apenas regravam os valores no buffer que não está em uso.
+ *
+ * Saídas antecipadas:
+ * - se uma potência intermediária for nula, todas as seguintes também são, e o resultado é a matriz nula;
+ * - se o quadrado for igual à potência anterior (P * P == P), os quadrados seguintes não mudam
+ *   e não são calculados.
+ *
+ * @param matriz Matriz quadrada A.
+ * @param expoente Expoente k (A^0 é a identidade).
+ * @param opcoes Poda opcional dos produtos intermediários.
+ * @return A matriz A^k.
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada ou o expoente for negativo.
+ */
+Matriz power(const Matriz &matriz, const int &expoente, const OpcoesPotencia &opcoes = {});
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef PRODUTO_ESPARSO_HPP
+#define PRODUTO_ESPARSO_HPP
+
+#include <vector>
+#include "matriz/Matriz.hpp"
+#include "matriz/VisaoMatriz.hpp"
+#include "matriz/Poda.hpp"
+
+/**
+ * @class ProdutoEsparso
+ * @brief Multiplicação em duas fases (simbólica e numérica) para produtos repetidos com o mesmo padrão.
+ *
+ * A fase simbólica, executada no construtor, determina as posições não nulas de C = A * B e
+ * aloca de uma só vez todos os nós do resultado. A fase numérica, calcular(), percorre as linhas
+ * de A e de B acumulando os produtos em um vetor denso reutilizado e regrava os valores dos nós
+ * já existentes, sem alocar memória. É indicada para laços em que A e B mudam apenas de valores.
+ *
+ * @note
+ * - As posições do resultado são fixas: cancelamentos numéricos ficam armazenados como zero.
+ * - Se A ou B passarem a ter um elemento fora do padrão da fase simbólica, calcular() lança
+ *   std::invalid_argument; posições que deixaram de existir apenas resultam em zero.
+ * - Cópias do resultado continuam independentes (cópia sob escrita): se o resultado estiver
+ *   compartilhado, a próxima chamada a calcular() separa a estrutura antes de regravá-la.
+ */
+class ProdutoEsparso
+{
+private:
+    int linhas;                      /**< Linhas de A (e de C). */
+    int internas;                    /**< Colunas de A, iguais às linhas de B. */
+    int colunas;                     /**< Colunas de B (e de C). */
+    Matriz resultado;                /**< Matriz C, com todos os nós alocados na fase simbólica. */
+    std::vector<Node *> nos;         /**< Nós de C em ordem de linhas. */
+    std::vector<size_t> inicioLinha; /**< Os nós da linha i ocupam nos[inicioLinha[i - 1]] até nos[inicioLinha[i] - 1]. */
+    std::vector<double> acumulador;  /**< Acumulador denso da linha em cálculo, indexado por coluna. */
+    std::vector<size_t> marca;       /**< Marca das colunas que pertencem à linha em cálculo. */
+    size_t geracao;                  /**< Valor de marca da linha em cálculo; evita limpar o vetor a cada linha. */
+
+    /**
+     * @brief Preenche nos e inicioLinha percorrendo as linhas do resultado.
+     */
+    void vincularNos();
+
+public:
+    /**
+     * @brief Executa a fase simbólica de A * B e, em seguida, a fase numérica.
+     *
+     * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+     */
+    ProdutoEsparso(const Matriz &matrizA, const Matriz &matrizB);
+
+    /**
+     * @brief Fase numérica: recalcula os valores de C = A * B sobre a estrutura já alocada.
+     *
+     * @return Referência para o resultado, válida enquanto o ProdutoEsparso existir.
+     *
+     * @throws std::invalid_argument Se as dimensões mudarem ou se A * B tiver posição fora do padrão simbólico;
+     *         no segundo caso, as linhas anteriores à posição inválida já terão sido recalculadas.
+     */
+    const Matriz &calcular(const Matriz &matrizA, const Matriz &matrizB);
+
+    /**
+     * @brief Retorna o resultado da última fase numérica.
+     */
+    const Matriz &getResultado() const;
+
+    /**
+     * @brief Retorna a quantidade de posições do resultado determinadas pela fase simbólica.
+     */
+    size_t quantidade() const;
+};
+
+/**
+ * @brief Área de trabalho reutilizável da multiplicação linha a linha (algoritmo de Gustavson).
+ *
+ * Guarda o acumulador denso, as marcas de coluna e a lista de colunas da linha em cálculo, para
+ * que multiplicações sucessivas (por exemplo, em potencia()) não realoquem esses vetores.
+ */
+struct EspacoProduto
+{
+    std::vector<double> acumulador; /**< Acumulador denso indexado por coluna. */
+    std::vector<size_t> marca;      /**< Geração em que cada coluna foi alcançada pela última vez. */
+    std::vector<int> colunasLinha;  /**< Colunas alcançadas na linha em cálculo. */
+    std::vector<double> valoresLinha; /**< Valores da linha em cálculo, usados apenas pela poda. */
+    size_t geracao{0};              /**< Geração da linha em cálculo. */
+
+    /**
+     * @brief Garante espaço para resultados com até \p colunas colunas.
+     */
+    void preparar(const int &colunas);
+};
+
+/**
+ * @brief Multiplica A * B linha a linha, sem consultas densas.
+ *
+ * Para cada linha i de A, as linhas de B indicadas pelas colunas de A(i, :) são acumuladas em um
+ * vetor denso; as colunas alcançadas são ordenadas e entregues ao ConstrutorMatriz. O custo é
+ * proporcional ao número de produtos escalares efetivamente realizados, e não a linhas * colunas * k.
+ * Posições cujo valor se anula não são armazenadas.
+ *
+ * Com \p opcoes, cada linha acumulada é podada antes de ir para o construtor (veja OpcoesPoda):
+ * os elementos descartados nunca são alocados, o que limita a memória de produtos sucessivos.
+ *
+ * @param espaco Área de trabalho reaproveitada entre chamadas.
+ * @param opcoes Tolerância e limite de elementos por linha do resultado (por padrão, nenhuma poda).
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+ */
+Matriz multiplicarEsparso(const Matriz &matrizA, const Matriz &matrizB, EspacoProduto &espaco, const OpcoesPoda &opcoes = {});
+
+/**
+ * @brief Multiplica dois blocos (VisaoMatriz) linha a linha, como multiplicarEsparso(), sem materializá-los.
+ *
+ * Cada linha k de B é percorrida apenas dentro da faixa de colunas da visão.
+ *
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+ */
+Matriz multiplicarEsparso(const VisaoMatriz &visaoA, const VisaoMatriz &visaoB, EspacoProduto &espaco, const OpcoesPoda &opcoes = {});
+
+/**
+ * @brief Calcula Aᵀ * B sem montar a transposta.
+ *
+ * A linha i do resultado soma as linhas k de B ponderadas por A(k, i); os elementos A(k, i) são
+ * obtidos percorrendo a lista circular da coluna i de A (ligações abaixo).
+ *
+ * @throws std::invalid_argument Se A e B não tiverem o mesmo número de linhas.
+ */
+Matriz multiplicarTranspostaA(const Matriz &matrizA, const Matriz &matrizB, EspacoProduto &espaco);
+
+/**
+ * @brief Calcula A * Bᵀ sem montar a transposta.
+ *
+ * A linha i do resultado soma, para cada A(i, k), a coluna k de B percorrida pelas ligações
+ * abaixo; cada B(j, k) contribui para a coluna j do resultado.
+ *
+ * @throws std::invalid_argument Se A e B não tiverem o mesmo número de colunas.
+ */
+Matriz multiplicarTranspostaB(const Matriz &matrizA, const Matriz &matrizB, EspacoProduto &espaco);
+
+/**
+ * @brief Calcula a matriz de Gram Aᵀ * A calculando apenas o triângulo superior.
+ *
+ * Para cada A(k, i) da coluna i, apenas o trecho da linha k a partir do próprio nó (colunas j >= i)
+ * é percorrido, o que evita cerca de metade dos produtos.
+ *
+ * @param apenasTrianguloSuperior Se verdadeiro, o resultado contém só o triângulo superior; caso
+ *        contrário, o triângulo inferior é espelhado durante a montagem.
+ */
+Matriz multiplicarGram(const Matriz &matriz, EspacoProduto &espaco, bool apenasTrianguloSuperior = false);
+
+#endif
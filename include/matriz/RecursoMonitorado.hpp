@@ -0,0 +1,80 @@
+#ifndef RECURSO_MONITORADO_HPP
+#define RECURSO_MONITORADO_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * @class RecursoMonitorado
+ * @brief Recurso de memória (std::pmr) que contabiliza as alocações e pode impor um limite de bytes.
+ *
+ * Repassa cada pedido a um recurso de origem e registra os bytes em uso, o pico de bytes e a
+ * quantidade de alocações e desalocações. Passado a uma Matriz (ou a ConstrutorMatriz::construir()),
+ * mede a memória dos nós daquela matriz e das cópias separadas dela; com um limite, faz a alocação
+ * que o ultrapassaria falhar com std::bad_alloc, o que permite impor um orçamento por tarefa.
+ *
+ * @note
+ * - Os contadores são atômicos: o recurso é seguro entre threads sempre que a origem também for.
+ * - O recurso precisa existir enquanto houver nós alocados nele.
+ */
+class RecursoMonitorado : public std::pmr::memory_resource
+{
+private:
+    std::pmr::memory_resource *origem;      /**< Recurso que de fato fornece a memória. */
+    std::atomic<size_t> limite;             /**< Máximo de bytes em uso (0 para ilimitado); atômico, pois setLimite() concorre com as alocações. */
+    std::atomic<size_t> bytesEmUso{0};      /**< Bytes alocados e ainda não devolvidos. */
+    std::atomic<size_t> picoBytes{0};       /**< Maior valor de bytesEmUso desde a criação ou reiniciarPico(). */
+    std::atomic<size_t> alocacoes{0};       /**< Alocações bem-sucedidas. */
+    std::atomic<size_t> desalocacoes{0};    /**< Desalocações. */
+    std::atomic<size_t> recusadas{0};       /**< Alocações recusadas pelo limite. */
+
+protected:
+    /**
+     * @brief Reserva os bytes no orçamento e repassa o pedido à origem.
+     *
+     * @throws std::bad_alloc Se a alocação ultrapassar o limite ou se a origem falhar.
+     */
+    void *do_allocate(std::size_t bytes, std::size_t alinhamento) override;
+
+    void do_deallocate(void *ponteiro, std::size_t bytes, std::size_t alinhamento) override;
+
+    /**
+     * @brief Apenas o próprio objeto é equivalente: memória de outro recurso não entra nesta contabilidade.
+     */
+    bool do_is_equal(const std::pmr::memory_resource &outro) const noexcept override;
+
+public:
+    /**
+     * @param limiteBytes Máximo de bytes em uso ao mesmo tempo; 0 não impõe limite.
+     * @param origem Recurso que fornece a memória; por padrão, o recurso padrão de std::pmr.
+     *
+     * @throws std::invalid_argument Se a origem for nula.
+     */
+    explicit RecursoMonitorado(const size_t &limiteBytes = 0,
+                               std::pmr::memory_resource *origem = std::pmr::get_default_resource());
+
+    RecursoMonitorado(const RecursoMonitorado &) = delete;
+    RecursoMonitorado &operator=(const RecursoMonitorado &) = delete;
+
+    size_t getBytesEmUso() const;
+    size_t getPicoBytes() const;
+    size_t getAlocacoes() const;
+    size_t getDesalocacoes() const;
+    size_t getRecusadas() const;
+    size_t getLimite() const;
+
+    /**
+     * @brief Altera o limite; alocações já feitas não são afetadas, mesmo que passem do novo valor.
+     *
+     * Pode ser chamada enquanto outras threads alocam: cada alocação usa o limite vigente no momento.
+     */
+    void setLimite(const size_t &limiteBytes);
+
+    /**
+     * @brief Recomeça a medição do pico a partir dos bytes em uso agora.
+     */
+    void reiniciarPico();
+};
+
+#endif
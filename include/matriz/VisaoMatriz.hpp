@@ -0,0 +1,149 @@
+#ifndef VISAO_MATRIZ_HPP
+#define VISAO_MATRIZ_HPP
+
+#include <vector>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @class VisaoMatriz
+ * @brief Bloco retangular [linhaInicial, linhaFinal] x [colunaInicial, colunaFinal] de uma Matriz, sem cópia dos elementos.
+ *
+ * A visão guarda uma cópia da matriz que compartilha a estrutura encadeada (O(1)) e percorre apenas
+ * o trecho de cada linha que cai na faixa de colunas. Os índices da visão começam em 1: o elemento
+ * (i, j) da visão é o elemento (linhaInicial + i - 1, colunaInicial + j - 1) da matriz.
+ *
+ * @details
+ * - Quando a faixa não começa na coluna 1, o construtor guarda o primeiro nó de cada linha dentro da
+ *   faixa. Ele percorre o início das linhas ou as colunas da faixa (ligações abaixo), o que for
+ *   mais barato segundo os contadores por linha e por coluna.
+ * - Percursos posteriores custam O(elementos dentro do bloco + linhas da visão).
+ * - Uma Matriz converte-se implicitamente em uma visão completa, de modo que sum(), multiply() e
+ *   VisaoMatriz::multiplicar() aceitam qualquer combinação de matrizes e visões.
+ *
+ * @note A visão enxerga a matriz no estado em que foi criada: como a estrutura é compartilhada,
+ *       a próxima alteração na matriz original a separa (copy-on-write, O(nnz)) e não aparece na
+ *       visão. Para editar a matriz, descarte antes as visões dela.
+ */
+class VisaoMatriz
+{
+private:
+    Matriz base;                         /**< Matriz de origem, com a estrutura compartilhada. */
+    int linhaInicial;                    /**< Primeira linha da matriz incluída na visão. */
+    int linhaFinal;                      /**< Última linha da matriz incluída na visão. */
+    int colunaInicial;                   /**< Primeira coluna da matriz incluída na visão. */
+    int colunaFinal;                     /**< Última coluna da matriz incluída na visão. */
+    std::vector<const Node *> inicioLinha; /**< Primeiro nó de cada linha com coluna >= colunaInicial (vazio se colunaInicial == 1). */
+
+    /**
+     * @brief Preenche inicioLinha pelo percurso mais barato (linhas ou colunas da faixa).
+     */
+    void indexarLinhas();
+
+public:
+    /**
+     * @brief Percorre os elementos de uma linha da visão em ordem crescente de coluna.
+     *
+     * @code
+     * for (auto cursor = visao.linha(i); cursor.valido(); cursor.avancar())
+     *     usar(cursor.coluna(), cursor.valor());
+     * @endcode
+     */
+    class CursorLinha
+    {
+    private:
+        const Node *atual;     /**< Nó corrente. */
+        const Node *sentinela; /**< Sentinela da linha na matriz de origem. */
+        int colunaFinal;       /**< Última coluna da faixa, nos índices da matriz de origem. */
+        int deslocamento;      /**< colunaInicial - 1, para converter a coluna para os índices da visão. */
+
+    public:
+        CursorLinha(const Node *atual, const Node *sentinela, const int &colunaFinal, const int &deslocamento)
+            : atual(atual), sentinela(sentinela), colunaFinal(colunaFinal), deslocamento(deslocamento) {}
+
+        bool valido() const { return atual != sentinela && atual->coluna <= colunaFinal; }
+        int coluna() const { return atual->coluna - deslocamento; }
+        double valor() const { return atual->valor; }
+        void avancar() { atual = atual->direita; }
+    };
+
+    /**
+     * @brief Visão da matriz inteira.
+     */
+    VisaoMatriz(const Matriz &matriz);
+
+    /**
+     * @brief Visão do bloco [linhaInicial, linhaFinal] x [colunaInicial, colunaFinal] (índices da matriz, inclusivos).
+     *
+     * @throws std::invalid_argument Se a faixa for vazia ou sair dos limites da matriz.
+     */
+    VisaoMatriz(const Matriz &matriz, const int &linhaInicial, const int &linhaFinal, const int &colunaInicial, const int &colunaFinal);
+
+    int getLinhas() const;
+    int getColunas() const;
+
+    /**
+     * @brief Cursor da linha \p posI da visão.
+     *
+     * @throws std::invalid_argument Se a linha estiver fora da visão.
+     */
+    CursorLinha linha(const int &posI) const;
+
+    /**
+     * @brief Retorna o valor na posição (posI, posJ) da visão (0 se não houver elemento).
+     *
+     * @throws std::invalid_argument Se a posição estiver fora da visão.
+     */
+    double get(const int &posI, const int &posJ) const;
+
+    /**
+     * @brief Quantidade de elementos dentro do bloco, contada em O(elementos do bloco + linhas).
+     */
+    size_t quantidade() const;
+
+    /**
+     * @brief Sub-bloco desta visão, com índices relativos à visão.
+     *
+     * @throws std::invalid_argument Se a faixa for vazia ou sair dos limites da visão.
+     */
+    VisaoMatriz view(const int &linhaInicial, const int &linhaFinal, const int &colunaInicial, const int &colunaFinal) const;
+
+    /**
+     * @brief Copia o bloco para uma Matriz independente, em ordem de linhas e sem ordenação.
+     *
+     * @param recurso Recurso de memória dos nós da nova matriz.
+     */
+    Matriz materialize(std::pmr::memory_resource *recurso = std::pmr::get_default_resource()) const;
+
+    /**
+     * @brief Produto matriz-vetor y = V * x.
+     *
+     * Como em MatrizCSR::multiplicar(), \p x e \p y começam na posição 0.
+     *
+     * @param x Vetor com getColunas() posições.
+     * @param y Vetor de saída; é redimensionado para getLinhas() posições.
+     *
+     * @throws std::invalid_argument Se o tamanho de \p x for diferente do número de colunas.
+     */
+    void multiplicar(const std::vector<double> &x, std::vector<double> &y) const;
+
+    /**
+     * @brief Imprime o bloco no console, no mesmo formato de Matriz::print().
+     */
+    void print() const;
+
+    /**
+     * @brief Matriz de origem (compartilhada) da visão.
+     */
+    const Matriz &getBase() const;
+};
+
+/**
+ * @brief Soma duas visões de mesmo tamanho intercalando as linhas, em O(elementos dos blocos + linhas).
+ *
+ * Posições cuja soma se anula não são armazenadas.
+ *
+ * @throws std::invalid_argument Se as visões não tiverem o mesmo tamanho.
+ */
+Matriz somarVisoes(const VisaoMatriz &visaoA, const VisaoMatriz &visaoB);
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef MATRIZ_CSR_HPP
+#define MATRIZ_CSR_HPP
+
+#include <vector>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @class MatrizCSR
+ * @brief Cópia congelada de uma Matriz no formato CSR (Compressed Sparse Row).
+ *
+ * Os elementos de cada linha ficam contíguos em dois vetores (colunas e valores), e inicioLinha
+ * indica onde cada linha começa. A estrutura não admite alterações: ela existe para percursos
+ * repetidos, como o produto matriz-vetor dos métodos iterativos, em que a leitura sequencial é
+ * muito mais rápida do que seguir os ponteiros da lista encadeada.
+ *
+ * @note Diferente da Matriz, os índices internos e os vetores x e y de multiplicar() começam em 0:
+ *       a linha i da Matriz corresponde à posição i - 1.
+ */
+class MatrizCSR
+{
+private:
+    int linhas;                       /**< Números de linhas. */
+    int colunas;                      /**< Números de colunas. */
+    std::vector<size_t> inicioLinha;  /**< Os elementos da linha i ocupam [inicioLinha[i], inicioLinha[i + 1]). */
+    std::vector<int> indicesColuna;   /**< Coluna (a partir de 0) de cada elemento. */
+    std::vector<double> valores;      /**< Valor de cada elemento. */
+
+    /**
+     * @brief Calcula y = A * x apenas para as linhas [inicio, fim).
+     */
+    void multiplicarFaixa(const std::vector<double> &x, std::vector<double> &y, const int &inicio, const int &fim) const;
+
+public:
+    /**
+     * @brief Congela a Matriz, percorrendo suas linhas uma única vez.
+     */
+    explicit MatrizCSR(const Matriz &origem);
+
+    int getLinhas() const;
+    int getColunas() const;
+
+    /**
+     * @brief Retorna a quantidade de elementos armazenados.
+     */
+    size_t quantidade() const;
+
+    /**
+     * @brief Produto matriz-vetor y = A * x.
+     *
+     * Com mais de uma thread, as linhas são divididas em faixas com aproximadamente a mesma
+     * quantidade de elementos; cada thread escreve apenas as posições de y da sua faixa.
+     *
+     * @param x Vetor com getColunas() posições.
+     * @param y Vetor de saída; é redimensionado para getLinhas() posições.
+     * @param threads Quantidade de threads (0 escolhe automaticamente; matrizes pequenas usam uma só).
+     *
+     * @throws std::invalid_argument Se o tamanho de \p x for diferente do número de colunas.
+     */
+    void multiplicar(const std::vector<double> &x, std::vector<double> &y, unsigned threads = 1) const;
+
+    /**
+     * @brief Retorna a diagonal principal (zero onde não há elemento armazenado).
+     */
+    std::vector<double> diagonal() const;
+
+    const std::vector<size_t> &getInicioLinha() const;
+    const std::vector<int> &getIndicesColuna() const;
+    const std::vector<double> &getValores() const;
+};
+
+#endif
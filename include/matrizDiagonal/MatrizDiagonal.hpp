@@ -0,0 +1,161 @@
+#ifndef MATRIZ_DIAGONAL_HPP
+#define MATRIZ_DIAGONAL_HPP
+
+#include <vector>
+#include <optional>
+#include "matriz/Matriz.hpp"
+
+class ConstrutorMatriz;
+
+/**
+ * @class MatrizDiagonal
+ * @brief Representação DIA (por diagonais) de matrizes diagonais ou em faixas.
+ *
+ * Cada diagonal ocupada é identificada pelo deslocamento k = j - i (0 é a diagonal principal,
+ * positivos acima dela) e guardada em um vetor contíguo com uma posição por linha. Uma matriz
+ * diagonal n x n ocupa n doubles, contra n nós de 32 bytes e o percurso de ponteiros da Matriz.
+ *
+ * @details
+ * A representação é opcional: é obtida de uma Matriz, de um ConstrutorMatriz ou de
+ * lerMatrizAdaptativa() (as cargas do menu e do modo lote não a usam), e convertida de volta com
+ * paraMatriz(). Os produtos com uma Matriz
+ * comum reduzem-se a escalar linhas (diagonal à esquerda) ou colunas (diagonal à direita)
+ * quando só a diagonal principal está ocupada.
+ *
+ * @note
+ * - Os índices de get() começam em 1, como na Matriz; os vetores de multiplicar() começam em 0.
+ * - Posições das diagonais ocupadas podem guardar zeros (inclusive as que caem fora da matriz
+ *   em matrizes retangulares); quantidade() conta apenas os não nulos.
+ */
+class MatrizDiagonal
+{
+private:
+    int linhas;                     /**< Números de linhas. */
+    int colunas;                    /**< Números de colunas. */
+    std::vector<int> deslocamentos; /**< Deslocamentos j - i das diagonais ocupadas, em ordem crescente. */
+    std::vector<double> valores;    /**< A diagonal d ocupa [d * linhas, (d + 1) * linhas), indexada pela linha (a partir de 0). */
+
+    /**
+     * @brief Cria uma matriz com as diagonais informadas, todas zeradas.
+     */
+    MatrizDiagonal(const int &lin, const int &col, std::vector<int> deslocamentos);
+
+    /**
+     * @brief Retorna a posição do deslocamento em `deslocamentos`, ou -1 se a diagonal não estiver ocupada.
+     */
+    int buscarDiagonal(const int &deslocamento) const;
+
+    /**
+     * @brief Copia os elementos da Matriz para as diagonais já criadas (que devem cobrir todos eles).
+     */
+    void copiar(const Matriz &origem);
+
+public:
+    /**
+     * @brief Copia a Matriz para o formato DIA, ocupando todas as diagonais em que ela tem elementos.
+     */
+    explicit MatrizDiagonal(const Matriz &origem);
+
+    /**
+     * @brief Decide se a matriz compensa no formato DIA e, nesse caso, a converte.
+     *
+     * Compensa quando os elementos não nulos preenchem pelo menos \p preenchimentoMinimo das
+     * posições das diagonais ocupadas (uma diagonal ou faixa densa tem preenchimento próximo de 1;
+     * elementos espalhados ocupam muitas diagonais quase vazias).
+     *
+     * @return A matriz no formato DIA, ou std::nullopt se ela não for diagonal nem em faixas.
+     */
+    static std::optional<MatrizDiagonal> detectar(const Matriz &origem, const double &preenchimentoMinimo = 0.5);
+
+    /**
+     * @brief Mesma decisão, tomada sobre os elementos de um ConstrutorMatriz antes de montar os nós.
+     *
+     * Posições repetidas seguem a regra do construtor: prevalece o último valor. O construtor não é alterado.
+     */
+    static std::optional<MatrizDiagonal> detectar(const ConstrutorMatriz &construtor, const double &preenchimentoMinimo = 0.5);
+
+    /**
+     * @brief Indica, em O(linhas) no pior caso, se todos os elementos da Matriz estão na diagonal principal.
+     */
+    static bool apenasDiagonalPrincipal(const Matriz &matriz);
+
+    int getLinhas() const;
+    int getColunas() const;
+
+    /**
+     * @brief Retorna os deslocamentos (j - i) das diagonais ocupadas, em ordem crescente.
+     */
+    const std::vector<int> &getDeslocamentos() const;
+
+    /**
+     * @brief Retorna a quantidade de elementos não nulos.
+     */
+    size_t quantidade() const;
+
+    /**
+     * @brief Indica se apenas a diagonal principal está ocupada.
+     */
+    bool diagonalPura() const;
+
+    /**
+     * @brief Retorna o valor de uma posição, ou 0 se ela não estiver em uma diagonal ocupada.
+     *
+     * @exception std::invalid_argument Se a posição estiver fora dos limites da matriz.
+     */
+    double get(const int &posI, const int &posJ) const;
+
+    /**
+     * @brief Produto matriz-vetor y = A * x, percorrendo cada diagonal como um vetor contíguo.
+     *
+     * @param x Vetor com getColunas() posições.
+     * @param y Vetor de saída; é redimensionado para getLinhas() posições.
+     *
+     * @throws std::invalid_argument Se o tamanho de \p x for diferente do número de colunas.
+     */
+    void multiplicar(const std::vector<double> &x, std::vector<double> &y) const;
+
+    /**
+     * @brief Converte de volta para uma Matriz encadeada (apenas os não nulos).
+     */
+    Matriz paraMatriz() const;
+
+    friend MatrizDiagonal sum(const MatrizDiagonal &matrizA, const MatrizDiagonal &matrizB);
+    friend MatrizDiagonal multiply(const MatrizDiagonal &matrizA, const MatrizDiagonal &matrizB);
+    friend Matriz multiply(const MatrizDiagonal &matrizA, const Matriz &matrizB);
+    friend Matriz multiply(const Matriz &matrizA, const MatrizDiagonal &matrizB);
+};
+
+/**
+ * @brief Soma duas matrizes DIA: as diagonais ocupadas são a união das duas, somadas vetor a vetor.
+ *
+ * @throws std::invalid_argument Se as matrizes não possuírem o mesmo tamanho.
+ */
+MatrizDiagonal sum(const MatrizDiagonal &matrizA, const MatrizDiagonal &matrizB);
+
+/**
+ * @brief Multiplica duas matrizes DIA: as diagonais ka de A e kb de B contribuem para a diagonal ka + kb.
+ *
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+ */
+MatrizDiagonal multiply(const MatrizDiagonal &matrizA, const MatrizDiagonal &matrizB);
+
+/**
+ * @brief Multiplica uma matriz DIA por uma Matriz.
+ *
+ * Se A for diagonal, cada linha i de B é apenas escalada por A(i, i), sem acumulador nem ordenação.
+ * Matrizes em faixas usam o produto esparso comum.
+ *
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+ */
+Matriz multiply(const MatrizDiagonal &matrizA, const Matriz &matrizB);
+
+/**
+ * @brief Multiplica uma Matriz por uma matriz DIA.
+ *
+ * Se B for diagonal, cada coluna j de A é apenas escalada por B(j, j).
+ *
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+ */
+Matriz multiply(const Matriz &matrizA, const MatrizDiagonal &matrizB);
+
+#endif
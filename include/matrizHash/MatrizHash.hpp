@@ -0,0 +1,132 @@
+#ifndef MATRIZ_HASH_HPP
+#define MATRIZ_HASH_HPP
+
+#include <vector>
+#include <cstdint>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @class MatrizHash
+ * @brief Matriz esparsa armazenada em uma tabela hash de endereçamento aberto.
+ *
+ * Alternativa à Matriz encadeada para cargas dominadas por leituras e atualizações pontuais.
+ * Cada elemento é guardado em uma tabela indexada pelo par (linha, coluna), com sondagem
+ * linear, de modo que get(), insert() e erase() custam O(1) esperado independentemente do
+ * tamanho das linhas.
+ *
+ * @details
+ * - A classe oferece os mesmos métodos de acesso da Matriz (getLinhas, getColunas, get,
+ *   insert, erase e limpar), permitindo trocar a representação sem alterar o código cliente.
+ * - A tabela não mantém ordem: quando for necessário um percurso ordenado (impressão, soma,
+ *   multiplicação), paraMatriz() monta a Matriz encadeada em lote, ordenando os elementos uma
+ *   única vez.
+ * - A remoção desloca os elementos seguintes do mesmo agrupamento (backward shift), evitando
+ *   marcadores de remoção que degradariam as buscas ao longo do tempo.
+ * - A tabela é redimensionada para o dobro sempre que a ocupação ultrapassa 70%.
+ *
+ * @note Os índices das linhas e colunas começam em 1, como na Matriz.
+ */
+class MatrizHash
+{
+private:
+    /**
+     * @brief Posição da tabela. A chave 0 indica posição livre, pois (0, 0) não é um índice válido.
+     */
+    struct Entrada
+    {
+        uint64_t chave; /**< Linha e coluna compactadas em 64 bits. */
+        double valor;   /**< Valor armazenado. */
+    };
+
+    int linhas;                  /**< Números de linhas. */
+    int colunas;                 /**< Números de colunas. */
+    size_t quantidadeElementos;  /**< Elementos não nulos armazenados. */
+    std::vector<Entrada> tabela; /**< Tabela de endereçamento aberto (tamanho potência de 2). */
+
+    static uint64_t compactar(const int &posI, const int &posJ);
+    static uint64_t espalhar(uint64_t chave);
+
+    /**
+     * @brief Localiza a posição da tabela que contém a chave ou a primeira posição livre do seu agrupamento.
+     */
+    size_t localizar(const uint64_t &chave) const;
+
+    /**
+     * @brief Realoca a tabela com a capacidade informada, reinserindo todos os elementos.
+     */
+    void redimensionar(const size_t &capacidade);
+
+    void validarPosicao(const int &posI, const int &posJ) const;
+
+public:
+    /**
+     * @brief Cria uma matriz vazia com as dimensões informadas.
+     *
+     * @param lin Quantidade de linhas (deve ser maior que zero).
+     * @param col Quantidade de colunas (deve ser maior que zero).
+     * @param capacidadeInicial Quantidade de elementos esperada, usada para dimensionar a tabela.
+     *
+     * @throw std::invalid_argument Se @p lin ou @p col forem menores ou iguais a zero.
+     */
+    MatrizHash(const int &lin, const int &col, const size_t &capacidadeInicial = 16);
+
+    /**
+     * @brief Cria a representação em tabela hash a partir de uma Matriz encadeada.
+     */
+    explicit MatrizHash(const Matriz &origem);
+
+    /**
+     * @brief Retorna a quantidade de linhas da matriz.
+     */
+    int getLinhas() const;
+
+    /**
+     * @brief Retorna a quantidade de colunas da matriz.
+     */
+    int getColunas() const;
+
+    /**
+     * @brief Retorna a quantidade de elementos não nulos armazenados.
+     */
+    size_t quantidade() const;
+
+    /**
+     * @brief Insere ou atualiza o valor em uma posição, em O(1) esperado.
+     *
+     * Valores iguais a zero são ignorados, como em Matriz::insert().
+     *
+     * @throws std::invalid_argument Se a posição estiver fora dos limites da matriz.
+     */
+    void insert(const int &posI, const int &posJ, const double &value);
+
+    /**
+     * @brief Retorna o valor de uma posição, em O(1) esperado, ou 0 caso não exista.
+     *
+     * @exception std::invalid_argument Se a posição estiver fora dos limites da matriz.
+     */
+    double get(const int &posI, const int &posJ) const;
+
+    /**
+     * @brief Remove o valor de uma posição, em O(1) esperado.
+     *
+     * @return true se um elemento foi removido, false caso a posição já estivesse vazia.
+     *
+     * @throws std::invalid_argument Se a posição estiver fora dos limites da matriz.
+     */
+    bool erase(const int &posI, const int &posJ);
+
+    /**
+     * @brief Remove todos os elementos, mantendo a capacidade da tabela.
+     */
+    void limpar();
+
+    /**
+     * @brief Converte para a Matriz encadeada, com os elementos ordenados por linha e coluna.
+     *
+     * A conversão usa o ConstrutorMatriz, custando uma ordenação dos elementos e uma única
+     * passada de ligação dos nós.
+     */
+    Matriz paraMatriz() const;
+};
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef MATRIZ_HIBRIDA_HPP
+#define MATRIZ_HIBRIDA_HPP
+
+#include <vector>
+#include <utility>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @brief Bloco denso (ladrilho) de uma MatrizHibrida.
+ *
+ * Armazena os valores de um ladrilho quadrado de forma contígua, em ordem de linhas.
+ * Ladrilhos na borda da matriz são completados com zeros, de modo que todo bloco
+ * possui exatamente tamanhoBloco x tamanhoBloco valores.
+ */
+struct BlocoDenso
+{
+    int linhaBloco;              /**< Índice (a partir de 0) da faixa de linhas do bloco. */
+    int colunaBloco;             /**< Índice (a partir de 0) da faixa de colunas do bloco. */
+    std::vector<double> valores; /**< Valores do bloco em ordem de linhas. */
+};
+
+/**
+ * @class MatrizHibrida
+ * @brief Representação híbrida de uma matriz esparsa: ladrilhos densos contíguos e uma Matriz esparsa para o restante.
+ *
+ * A matriz é dividida em ladrilhos de tamanho fixo. Os ladrilhos cuja densidade atinge o limite
+ * informado são armazenados como vetores contíguos (BlocoDenso), eliminando os 32 bytes e os dois
+ * saltos de ponteiro que cada valor custa nas listas encadeadas. Os demais elementos permanecem
+ * em uma Matriz comum.
+ *
+ * @details
+ * A representação é opcional: é construída a partir de uma Matriz já carregada e pode ser
+ * convertida de volta com paraMatriz(). As operações sum() e multiply() sobre matrizes híbridas
+ * despacham os produtos ladrilho x ladrilho para um kernel denso em blocos, e tratam os termos
+ * que envolvem a parte esparsa com um acumulador por linha.
+ *
+ * @note
+ * - Os índices das linhas e colunas começam em 1, como na Matriz.
+ * - Operações entre matrizes híbridas exigem o mesmo tamanho de bloco.
+ */
+class MatrizHibrida
+{
+private:
+    int linhas;                                                   /**< Números de linhas. */
+    int colunas;                                                  /**< Números de colunas. */
+    int tamanhoBloco;                                             /**< Lado dos ladrilhos. */
+    std::vector<BlocoDenso> blocos;                               /**< Ladrilhos densos armazenados. */
+    std::vector<std::vector<std::pair<int, int>>> blocosPorFaixa; /**< Para cada faixa de linhas, pares (colunaBloco, índice em blocos) ordenados. */
+    Matriz esparsa;                                               /**< Elementos fora dos ladrilhos densos. */
+
+    /**
+     * @brief Cria uma matriz híbrida vazia com as dimensões e o tamanho de bloco informados.
+     */
+    MatrizHibrida(const int &lin, const int &col, const int &tamanhoBloco);
+
+    /**
+     * @brief Procura o ladrilho denso que cobre a faixa informada.
+     *
+     * @return Índice do ladrilho em `blocos`, ou -1 caso a região seja esparsa.
+     */
+    int buscarBloco(const int &linhaBloco, const int &colunaBloco) const;
+
+    /**
+     * @brief Cria um ladrilho denso zerado na faixa informada, mantendo `blocosPorFaixa` ordenado.
+     *
+     * @return Índice do novo ladrilho em `blocos`.
+     */
+    int adicionarBloco(const int &linhaBloco, const int &colunaBloco);
+
+public:
+    /**
+     * @brief Constrói a representação híbrida a partir de uma Matriz.
+     *
+     * Percorre a matriz duas vezes: a primeira conta os elementos de cada ladrilho e decide quais
+     * são densos; a segunda copia os valores para os blocos contíguos ou para a parte esparsa.
+     *
+     * @param origem Matriz de origem.
+     * @param tamanhoBloco Lado dos ladrilhos (deve ser maior que zero).
+     * @param densidadeMinima Fração de elementos não nulos, em relação à área real do ladrilho,
+     *                        a partir da qual o ladrilho passa a ser armazenado de forma densa.
+     *
+     * @throw std::invalid_argument Se @p tamanhoBloco for menor ou igual a zero.
+     */
+    explicit MatrizHibrida(const Matriz &origem, const int &tamanhoBloco = 32, const double &densidadeMinima = 0.5);
+
+    /**
+     * @brief Retorna a quantidade de linhas da matriz.
+     */
+    int getLinhas() const;
+
+    /**
+     * @brief Retorna a quantidade de colunas da matriz.
+     */
+    int getColunas() const;
+
+    /**
+     * @brief Retorna o lado dos ladrilhos usados pela matriz.
+     */
+    int getTamanhoBloco() const;
+
+    /**
+     * @brief Retorna a quantidade de ladrilhos armazenados de forma densa.
+     */
+    size_t quantidadeBlocos() const;
+
+    /**
+     * @brief Retorna a parte esparsa da matriz (elementos fora dos ladrilhos densos).
+     */
+    const Matriz &getEsparsa() const;
+
+    /**
+     * @brief Retorna o valor armazenado em uma posição da matriz.
+     *
+     * @param posI Índice da linha (deve estar no intervalo [1, linhas]).
+     * @param posJ Índice da coluna (deve estar no intervalo [1, colunas]).
+     * @return O valor na posição, ou 0 caso não exista.
+     *
+     * @exception std::invalid_argument Se a posição estiver fora dos limites da matriz.
+     */
+    double get(const int &posI, const int &posJ) const;
+
+    /**
+     * @brief Converte a representação híbrida de volta para uma Matriz encadeada.
+     *
+     * @return Uma nova Matriz com todos os elementos não nulos.
+     */
+    Matriz paraMatriz() const;
+
+    friend MatrizHibrida sum(const MatrizHibrida &matrizA, const MatrizHibrida &matrizB);
+    friend MatrizHibrida multiply(const MatrizHibrida &matrizA, const MatrizHibrida &matrizB);
+};
+
+/**
+ * @brief Soma duas matrizes híbridas de mesmo tamanho.
+ *
+ * Os ladrilhos densos são somados elemento a elemento sobre os vetores contíguos; as partes
+ * esparsas são intercaladas linha a linha. Elementos esparsos que caem dentro de um ladrilho
+ * denso do resultado são acumulados no próprio ladrilho.
+ *
+ * @throws std::invalid_argument Se as dimensões ou os tamanhos de bloco forem diferentes.
+ */
+MatrizHibrida sum(const MatrizHibrida &matrizA, const MatrizHibrida &matrizB);
+
+/**
+ * @brief Multiplica duas matrizes híbridas.
+ *
+ * @details
+ * - Cada par de ladrilhos densos A(I, K) x B(K, J) é resolvido por um kernel denso em blocos,
+ *   acumulando diretamente no ladrilho C(I, J).
+ * - Os termos restantes (denso x esparso, esparso x denso e esparso x esparso) são calculados
+ *   linha a linha com um acumulador denso de tamanho igual ao número de colunas de B.
+ *
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B
+ *                               ou se os tamanhos de bloco forem diferentes.
+ */
+MatrizHibrida multiply(const MatrizHibrida &matrizA, const MatrizHibrida &matrizB);
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef CACHE_RESULTADOS_HPP
+#define CACHE_RESULTADOS_HPP
+
+#include <list>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @brief Operações cujos resultados são guardados pelo CacheResultados.
+ */
+enum class OperacaoCache
+{
+    Soma,         /**< sum(A, B). */
+    Multiplicacao /**< multiply(A, B). */
+};
+
+/**
+ * @class CacheResultados
+ * @brief Guarda os resultados recentes de soma e multiplicação, indexados pelo conteúdo dos operandos.
+ *
+ * A chave é a operação mais a identidade e a versão de cada operando (Matriz::getIdentidade() e
+ * Matriz::getVersao()). Repetir a operação sobre operandos inalterados devolve o resultado guardado
+ * em O(1); qualquer alteração em um operando muda a sua versão ou identidade, de modo que o
+ * resultado antigo deixa de ser encontrado sem nenhuma invalidação explícita e sai do cache pela
+ * política LRU.
+ *
+ * @note
+ * - Os resultados são cópias com estrutura compartilhada (copy-on-write): alterar o resultado
+ *   devolvido não altera o guardado.
+ * - O cache não mantém os operandos vivos, apenas as suas identidades, que não são reaproveitadas.
+ * - Além da quantidade de resultados, a memória guardada pode ser limitada em bytes (estimada por
+ *   Matriz::memoryUsage()). Um resultado guardado continua ocupando memória enquanto estiver no
+ *   cache, mesmo que as cópias devolvidas sejam descartadas ou despejadas por um RegistroMatrizes;
+ *   para respeitar um orçamento total, reserve uma parte dele para o cache.
+ * - Uma matriz recarregada do disco (ou lida de novo do arquivo) é uma estrutura nova e não
+ *   encontra os resultados calculados antes.
+ * - O cache não é seguro entre threads.
+ */
+class CacheResultados
+{
+private:
+    /**
+     * @brief Operação e estado exato dos dois operandos.
+     */
+    struct Chave
+    {
+        OperacaoCache operacao;
+        uint64_t identidadeA;
+        uint64_t versaoA;
+        uint64_t identidadeB;
+        uint64_t versaoB;
+
+        bool operator==(const Chave &outra) const = default;
+    };
+
+    struct HashChave
+    {
+        size_t operator()(const Chave &chave) const;
+    };
+
+    /**
+     * @brief Resultado guardado e a memória estimada dele.
+     */
+    struct Entrada
+    {
+        Chave chave;
+        Matriz resultado;
+        size_t bytes;
+    };
+
+    using Lista = std::list<Entrada>;
+
+    size_t capacidade;                                       /**< Máximo de resultados guardados. */
+    size_t limiteBytes;                                      /**< Máximo de bytes guardados (0 para ilimitado). */
+    size_t bytes{0};                                         /**< Soma de Matriz::memoryUsage() dos resultados guardados. */
+    Lista resultados;                                        /**< Resultados, do usado mais recentemente ao menos. */
+    std::unordered_map<Chave, Lista::iterator, HashChave> indice; /**< Posição de cada chave em resultados. */
+    size_t acertos{0};                                       /**< Operações respondidas pelo cache. */
+    size_t faltas{0};                                        /**< Operações calculadas. */
+
+    /**
+     * @brief Devolve o resultado guardado para a chave ou o calcula e guarda.
+     */
+    Matriz buscarOuCalcular(const Chave &chave, const std::function<Matriz()> &calcular);
+
+public:
+    /**
+     * @param capacidade Máximo de resultados guardados; 0 desabilita o cache.
+     * @param limiteBytes Máximo de bytes guardados; 0 não impõe limite. Um resultado maior que o limite
+     *                    é devolvido sem ser guardado.
+     */
+    explicit CacheResultados(const size_t &capacidade = 8, const size_t &limiteBytes = 0);
+
+    /**
+     * @brief Retorna sum(A, B), reaproveitando o resultado se A e B não mudaram desde o último cálculo.
+     *
+     * @throws std::invalid_argument Nos mesmos casos de sum().
+     */
+    Matriz somar(const Matriz &matrizA, const Matriz &matrizB);
+
+    /**
+     * @brief Retorna multiply(A, B), reaproveitando o resultado se A e B não mudaram desde o último cálculo.
+     *
+     * @throws std::invalid_argument Nos mesmos casos de multiply().
+     */
+    Matriz multiplicar(const Matriz &matrizA, const Matriz &matrizB);
+
+    /**
+     * @brief Descarta todos os resultados guardados (os contadores são mantidos).
+     */
+    void limpar();
+
+    size_t size() const;
+    size_t getCapacidade() const;
+    size_t getLimiteBytes() const;
+
+    /**
+     * @brief Memória estimada dos resultados guardados.
+     */
+    size_t getBytes() const;
+    size_t getAcertos() const;
+    size_t getFaltas() const;
+};
+
+#endif
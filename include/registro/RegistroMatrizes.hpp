@@ -0,0 +1,184 @@
+#ifndef REGISTRO_MATRIZES_HPP
+#define REGISTRO_MATRIZES_HPP
+
+#include <string>
+#include <vector>
+#include <list>
+#include <optional>
+#include <filesystem>
+#include <unordered_map>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @brief Contadores de uso de um RegistroMatrizes.
+ */
+struct EstatisticasRegistro
+{
+    size_t acertos{0};        /**< Acessos a matrizes que estavam em memória. */
+    size_t faltas{0};         /**< Acessos que precisaram recarregar a matriz do disco. */
+    size_t despejos{0};       /**< Matrizes retiradas da memória para respeitar o orçamento. */
+    size_t gravacoes{0};      /**< Instantâneos gravados em disco (um despejo sem alterações desde a última gravação não grava). */
+    size_t bytesEmMemoria{0}; /**< Soma de Matriz::memoryUsage() das matrizes em memória. */
+    size_t emMemoria{0};      /**< Matrizes em memória. */
+    size_t emDisco{0};        /**< Matrizes disponíveis apenas no disco. */
+};
+
+/**
+ * @brief Resumo de uma matriz registrada, disponível mesmo quando ela está apenas no disco.
+ */
+struct InfoRegistro
+{
+    std::string nome;   /**< Nome da matriz no registro. */
+    int linhas;         /**< Números de linhas. */
+    int colunas;        /**< Números de colunas. */
+    size_t quantidade;  /**< Elementos não nulos. */
+    size_t bytes;       /**< Memória estimada quando carregada (Matriz::memoryUsage()). */
+    bool emMemoria;     /**< Indica se a matriz está carregada. */
+};
+
+/**
+ * @class RegistroMatrizes
+ * @brief Mapa de matrizes por nome com orçamento de memória e despejo para o disco.
+ *
+ * Quando a memória estimada das matrizes carregadas passa do orçamento, as menos usadas
+ * recentemente (LRU) são gravadas em instantâneos binários num diretório temporário e liberadas.
+ * obter() recarrega a matriz de forma transparente.
+ *
+ * @details
+ * - obter() devolve uma cópia, que compartilha a estrutura (copy-on-write): continua válida mesmo
+ *   que o registro despeje a matriz depois, e alterá-la não altera a matriz registrada. Para gravar
+ *   uma alteração no registro, use definir().
+ * - Como a matriz registrada só muda por definir(), um instantâneo continua válido depois da
+ *   recarga, e despejá-la de novo não regrava o arquivo.
+ * - A matriz acessada por último nunca é despejada, mesmo que sozinha ultrapasse o orçamento.
+ * - Matrizes recarregadas usam o recurso de memória padrão.
+ *
+ * @note O registro não é seguro entre threads. O diretório dos instantâneos é removido pelo destrutor.
+ */
+class RegistroMatrizes
+{
+private:
+    /**
+     * @brief Matriz registrada, em memória ou apenas no disco.
+     */
+    struct Entrada
+    {
+        std::optional<Matriz> matriz;         /**< Vazio quando a matriz foi despejada. */
+        std::filesystem::path arquivo;        /**< Instantâneo em disco (vazio se nunca gravado). */
+        bool instantaneoValido{false};        /**< O instantâneo corresponde à matriz atual. */
+        int linhas{0};                        /**< Números de linhas. */
+        int colunas{0};                       /**< Números de colunas. */
+        size_t quantidade{0};                 /**< Elementos não nulos. */
+        size_t bytes{0};                      /**< Memória estimada quando carregada. */
+        std::list<std::string>::iterator uso; /**< Posição em usoRecente (apenas com a matriz em memória). */
+    };
+
+    size_t orcamento;                                   /**< Máximo de bytes em memória (0 para ilimitado). */
+    std::filesystem::path diretorio;                    /**< Diretório exclusivo dos instantâneos. */
+    std::unordered_map<std::string, Entrada> entradas;  /**< Matrizes registradas. */
+    std::list<std::string> usoRecente;                  /**< Matrizes em memória, da usada mais recentemente à menos. */
+    EstatisticasRegistro estatisticas;                  /**< Contadores expostos por getEstatisticas(). */
+    size_t proximoArquivo{0};                           /**< Numeração dos instantâneos. */
+
+    /**
+     * @brief Coloca a matriz em memória e na frente de usoRecente.
+     */
+    void carregarEntrada(const std::string &nome, Entrada &entrada, const Matriz &matriz);
+
+    /**
+     * @brief Grava o instantâneo (se necessário) e libera a matriz da memória.
+     *
+     * @throws std::runtime_error Se o instantâneo não puder ser gravado; a matriz continua em memória.
+     */
+    void despejar(Entrada &entrada);
+
+    /**
+     * @brief Despeja as matrizes menos usadas até respeitar o orçamento, preservando a mais recente.
+     */
+    void respeitarOrcamento();
+
+    /**
+     * @brief Remove o instantâneo da entrada, se existir.
+     */
+    void descartarInstantaneo(Entrada &entrada);
+
+public:
+    /**
+     * @brief Cria o registro e um diretório exclusivo para os instantâneos dentro de \p base.
+     *
+     * @param orcamentoBytes Máximo de bytes das matrizes em memória; 0 não impõe limite.
+     * @param base Diretório onde o diretório dos instantâneos é criado; por padrão, o temporário do sistema.
+     *
+     * @throws std::runtime_error Se o diretório não puder ser criado.
+     */
+    explicit RegistroMatrizes(const size_t &orcamentoBytes = 0,
+                              const std::filesystem::path &base = std::filesystem::temp_directory_path());
+
+    /**
+     * @brief Remove o diretório dos instantâneos.
+     */
+    ~RegistroMatrizes();
+
+    RegistroMatrizes(const RegistroMatrizes &) = delete;
+    RegistroMatrizes &operator=(const RegistroMatrizes &) = delete;
+
+    /**
+     * @brief Indica se existe uma matriz com o nome informado, sem carregá-la.
+     */
+    bool contem(const std::string &nome) const;
+
+    /**
+     * @brief Registra a matriz se o nome ainda não existir.
+     *
+     * @return true se a matriz foi registrada; false se o nome já existia (nada é alterado).
+     */
+    bool inserir(const std::string &nome, const Matriz &matriz);
+
+    /**
+     * @brief Registra a matriz, substituindo a anterior de mesmo nome (e o seu instantâneo).
+     */
+    void definir(const std::string &nome, const Matriz &matriz);
+
+    /**
+     * @brief Retorna a matriz, recarregando-a do disco se tiver sido despejada.
+     *
+     * @throws std::invalid_argument Se não existir matriz com o nome informado.
+     * @throws std::runtime_error Se o instantâneo não puder ser lido.
+     */
+    Matriz obter(const std::string &nome);
+
+    /**
+     * @brief Remove a matriz e o seu instantâneo.
+     *
+     * @return true se a matriz existia.
+     */
+    bool remover(const std::string &nome);
+
+    /**
+     * @brief Resumo de uma matriz, sem carregá-la.
+     *
+     * @throws std::invalid_argument Se não existir matriz com o nome informado.
+     */
+    InfoRegistro resumo(const std::string &nome) const;
+
+    /**
+     * @brief Lista as matrizes registradas, em ordem de nome, sem carregar as que estão no disco.
+     */
+    std::vector<InfoRegistro> listar() const;
+
+    size_t size() const;
+    bool empty() const;
+
+    const EstatisticasRegistro &getEstatisticas() const;
+
+    size_t getOrcamento() const;
+
+    /**
+     * @brief Altera o orçamento, despejando de imediato o que for necessário.
+     */
+    void setOrcamento(const size_t &orcamentoBytes);
+
+    const std::filesystem::path &getDiretorio() const;
+};
+
+#endif
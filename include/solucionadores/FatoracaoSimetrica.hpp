@@ -0,0 +1,104 @@
+#ifndef FATORACAO_SIMETRICA_HPP
+#define FATORACAO_SIMETRICA_HPP
+
+#include <vector>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @brief Tipo de fatoração de uma matriz simétrica.
+ */
+enum class TipoFatoracao
+{
+    Cholesky, /**< A = L Lᵀ; exige matriz definida positiva. */
+    LDLT      /**< A = L D Lᵀ com L unitária; aceita matrizes indefinidas com pivôs não nulos. */
+};
+
+/**
+ * @brief Ordenação simétrica aplicada antes da fatoração.
+ */
+enum class OrdenacaoFatoracao
+{
+    Natural,   /**< Fatora na ordem das linhas da matriz. */
+    MinimoGrau /**< Elimina primeiro os vértices de menor grau, reduzindo o preenchimento do fator. */
+};
+
+/**
+ * @class FatoracaoSimetrica
+ * @brief Método direto para sistemas A x = b com A esparsa e simétrica.
+ *
+ * A construção faz três etapas:
+ * -# ordenação P (mínimo grau, por padrão) para limitar o preenchimento;
+ * -# análise simbólica de P A Pᵀ: árvore de eliminação e quantidade de elementos de cada coluna de L,
+ *    o que permite alocar o fator de uma só vez;
+ * -# fatoração numérica, linha a linha, seguindo os caminhos da árvore de eliminação.
+ *
+ * O fator é guardado por colunas (CSC) e pode ser reaproveitado para quantos lados direitos forem
+ * necessários; refatorar() repete apenas a fase numérica para uma matriz com o mesmo padrão.
+ *
+ * @note A fatoração de Cholesky é calculada na forma sem raízes L D Lᵀ e apenas exige pivôs positivos;
+ *       fator() devolve o fator de Cholesky L √D. Os vetores de resolver() começam em 0.
+ */
+class FatoracaoSimetrica
+{
+private:
+    int n;                                /**< Ordem da matriz. */
+    TipoFatoracao tipo;                   /**< Cholesky ou LDLᵀ. */
+    std::vector<int> permutacao;          /**< permutacao[k] é a linha (a partir de 0) eliminada na etapa k. */
+    std::vector<int> inversa;             /**< Inversa de permutacao. */
+    std::vector<int> pai;                 /**< Árvore de eliminação de P A Pᵀ (-1 nas raízes). */
+    std::vector<size_t> inicioA;          /**< Padrão da matriz original (linhas, como na MatrizCSR). */
+    std::vector<int> colunasA;            /**< Colunas da matriz original, a partir de 0. */
+    std::vector<size_t> inicioColuna;     /**< Os elementos da coluna j de L ocupam [inicioColuna[j], inicioColuna[j + 1]). */
+    std::vector<int> indicesLinha;        /**< Linha de cada elemento de L (abaixo da diagonal). */
+    std::vector<double> valoresL;         /**< Valor de cada elemento de L. */
+    std::vector<double> d;                /**< Diagonal D. */
+
+    /**
+     * @brief Fase numérica sobre o padrão já analisado.
+     */
+    void fatorarNumerico(const std::vector<double> &valoresA);
+
+public:
+    /**
+     * @brief Ordena, analisa e fatora a matriz.
+     *
+     * @throws std::invalid_argument Se a matriz não for quadrada ou simétrica, se algum pivô for nulo
+     *         ou, para Cholesky, se algum pivô não for positivo.
+     */
+    explicit FatoracaoSimetrica(const Matriz &matriz, const TipoFatoracao &tipo = TipoFatoracao::Cholesky,
+                                const OrdenacaoFatoracao &ordenacao = OrdenacaoFatoracao::MinimoGrau);
+
+    /**
+     * @brief Refaz apenas a fase numérica, mantendo ordenação e análise simbólica.
+     *
+     * @throws std::invalid_argument Se o padrão de \p matriz for diferente do padrão fatorado, ou pelos
+     *         mesmos motivos da construção.
+     */
+    void refatorar(const Matriz &matriz);
+
+    /**
+     * @brief Resolve A x = b usando o fator.
+     *
+     * @param b Lado direito, com getOrdem() posições.
+     * @throws std::invalid_argument Se o tamanho de \p b for diferente da ordem da matriz.
+     */
+    std::vector<double> resolver(const std::vector<double> &b) const;
+
+    /**
+     * @brief Retorna o fator triangular inferior de P A Pᵀ: L √D para Cholesky, L unitária para LDLᵀ.
+     */
+    Matriz fator() const;
+
+    int getOrdem() const;
+
+    /**
+     * @brief Elementos de L abaixo da diagonal, o que mede o preenchimento causado pela ordenação.
+     */
+    size_t quantidadeFator() const;
+
+    const std::vector<int> &getPermutacao() const;
+    const std::vector<int> &getArvoreEliminacao() const;
+    const std::vector<double> &getDiagonal() const;
+};
+
+#endif
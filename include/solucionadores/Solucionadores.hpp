@@ -0,0 +1,82 @@
+#ifndef SOLUCIONADORES_HPP
+#define SOLUCIONADORES_HPP
+
+#include <vector>
+#include "matriz/Matriz.hpp"
+
+/**
+ * @file Solucionadores.hpp
+ * @brief Métodos iterativos para sistemas lineares esparsos A x = b.
+ *
+ * Todos os métodos congelam a matriz em uma MatrizCSR antes de iterar, de modo que o produto
+ * matriz-vetor percorre vetores contíguos em vez das listas encadeadas, e pode ser dividido
+ * entre várias threads.
+ *
+ * @note Os vetores b e x começam em 0: a posição i - 1 corresponde à linha i da Matriz.
+ */
+
+/**
+ * @brief Parâmetros de parada e de execução dos métodos iterativos.
+ */
+struct OpcoesSolucionador
+{
+    double tolerancia{1e-10};  /**< Para quando ||b - A x|| / ||b|| for menor ou igual a este valor. */
+    int maxIteracoes{1000};    /**< Quantidade máxima de iterações. */
+    unsigned threads{0};       /**< Threads do produto matriz-vetor (0 escolhe automaticamente). */
+    bool precondicionar{true}; /**< Gradiente conjugado: usa o precondicionador de Jacobi (diagonal). */
+};
+
+/**
+ * @brief Resultado de um método iterativo.
+ */
+struct ResultadoSolucionador
+{
+    std::vector<double> x;          /**< Solução aproximada. */
+    int iteracoes{0};               /**< Iterações executadas. */
+    bool convergiu{false};          /**< Indica se a tolerância foi atingida. */
+    double residuo{0.0};            /**< Resíduo relativo final, ||b - A x|| / ||b||. */
+    std::vector<double> historico;  /**< Resíduo relativo inicial e após cada iteração. */
+};
+
+/**
+ * @brief Gradiente conjugado, opcionalmente precondicionado pela diagonal (Jacobi).
+ *
+ * Indicado para matrizes simétricas definidas positivas. Cada iteração faz um produto
+ * matriz-vetor e algumas operações vetoriais.
+ *
+ * @param matriz Matriz quadrada simétrica definida positiva.
+ * @param b Lado direito, com getLinhas() posições.
+ * @param opcoes Tolerância, limite de iterações e threads.
+ * @param x0 Aproximação inicial (vazio equivale ao vetor nulo).
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada, os vetores tiverem tamanho incompatível
+ *         ou, com precondicionamento, algum elemento da diagonal não for positivo.
+ */
+ResultadoSolucionador gradienteConjugado(const Matriz &matriz, const std::vector<double> &b,
+                                         const OpcoesSolucionador &opcoes = {}, const std::vector<double> &x0 = {});
+
+/**
+ * @brief Método de Jacobi: x(k+1) = x(k) + D⁻¹ (b - A x(k)).
+ *
+ * Converge para matrizes diagonalmente dominantes. Como cada iteração depende apenas da anterior,
+ * todo o trabalho está no produto matriz-vetor, que é dividido entre as threads.
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada, os vetores tiverem tamanho incompatível
+ *         ou houver zero na diagonal.
+ */
+ResultadoSolucionador jacobi(const Matriz &matriz, const std::vector<double> &b,
+                             const OpcoesSolucionador &opcoes = {}, const std::vector<double> &x0 = {});
+
+/**
+ * @brief Método de Gauss-Seidel: como Jacobi, mas usando os valores já atualizados na mesma varredura.
+ *
+ * Costuma convergir em menos iterações que Jacobi. A varredura é sequencial por natureza; apenas
+ * o cálculo do resíduo usa o produto matriz-vetor paralelo.
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada, os vetores tiverem tamanho incompatível
+ *         ou houver zero na diagonal.
+ */
+ResultadoSolucionador gaussSeidel(const Matriz &matriz, const std::vector<double> &b,
+                                  const OpcoesSolucionador &opcoes = {}, const std::vector<double> &x0 = {});
+
+#endif
@@ -2,12 +2,17 @@
 #define UTILS_HPP
 
 #include "matriz/Matriz.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include "matriz/ProdutoEsparso.hpp"
+#include "matrizDiagonal/MatrizDiagonal.hpp"
 
 /**
  * @brief Soma duas matrizes de mesmo tamanho.
  *
  * Esta função realiza a soma elemento a elemento das matrizes passadas por parâmetro,
- * retornando uma nova matriz com o resultado.
+ * retornando uma nova matriz com o resultado. As linhas de \p matrixA e \p matrizB são intercaladas
+ * em ordem de coluna e repassadas ao ConstrutorMatriz, em O(nnz) e sem consultas densas. Como em
+ * multiply(), o resultado é alocado no recurso padrão, e não no recurso de \p matrixA.
  *
  * @param matrixA Primeira matriz de entrada, cujas dimensões (linhas e colunas)
  *                devem ser iguais às de \p matrizB.
@@ -20,24 +25,41 @@
  * @return Uma nova matriz que representa o resultado da soma elemento a elemento
  *         de \p matrixA e \p matrizB, mantendo as mesmas dimensões das matrizes de entrada.
  */
-Matriz sum(const Matriz &matrixA, const Matriz &matrizB)
+inline Matriz sum(const Matriz &matrixA, const Matriz &matrizB)
 {
     if (matrixA.getLinhas() != matrizB.getLinhas() || matrixA.getColunas() != matrizB.getColunas())
         throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho");
 
-    Matriz matriz(matrixA.getLinhas(), matrixA.getColunas());
+    ConstrutorMatriz construtor(matrixA.getLinhas(), matrixA.getColunas());
 
-    for (int i = 1, linha = matrixA.getLinhas(); i <= linha; i++)
+    for (int i = 1; i <= matrixA.getLinhas(); i++)
     {
-        for (int j = 1, coluna = matrixA.getColunas(); j <= coluna; j++)
-        {
-            double valor = matrixA.get(i, j) + matrizB.get(i, j);
+        const Node *sentinelaA = matrixA.getSentinelaLinha(i), *sentinelaB = matrizB.getSentinelaLinha(i);
+        const Node *a = sentinelaA->direita, *b = sentinelaB->direita;
 
-            matriz.insert(i, j, valor);
+        // Intercalação das duas linhas, já em ordem de coluna; o construtor descarta as somas nulas
+        while (a != sentinelaA || b != sentinelaB)
+        {
+            if (b == sentinelaB || (a != sentinelaA && a->coluna < b->coluna))
+            {
+                construtor.adicionar(i, a->coluna, a->valor);
+                a = a->direita;
+            }
+            else if (a == sentinelaA || b->coluna < a->coluna)
+            {
+                construtor.adicionar(i, b->coluna, b->valor);
+                b = b->direita;
+            }
+            else
+            {
+                construtor.adicionar(i, a->coluna, a->valor + b->valor);
+                a = a->direita;
+                b = b->direita;
+            }
         }
     }
 
-    return matriz;
+    return construtor.construir();
 }
 
 /**
@@ -53,39 +75,99 @@ Matriz sum(const Matriz &matrixA, const Matriz &matrizB)
  * @throws std::invalid_argument Se o número de colunas de matrizA for diferente do número de linhas de matrizB.
  *
  * @details
- * A multiplicação de matrizes é realizada da seguinte forma:
- * - Para cada linha i de matrizA e cada coluna j de matrizB, calcula-se o produto escalar entre a linha i de matrizA e a coluna j de matrizB.
- * - O valor resultante é inserido na posição (i, j) da matriz resultante.
+ * A multiplicação de matrizes é realizada linha a linha (ver multiplicarEsparso()):
+ * - Para cada elemento A(i, k) da linha i de matrizA, a linha k de matrizB é acumulada, multiplicada por A(i, k), em um vetor denso.
+ * - As colunas alcançadas formam a linha i da matriz resultante, montada de uma só vez pelo ConstrutorMatriz.
+ *
+ * Se uma das matrizes for diagonal, o produto se reduz a escalar as linhas (ou as colunas) da outra.
+ *
+ * Com \p opcoes, cada linha do resultado é podada durante a acumulação: os elementos com |v| menor que
+ * a tolerância, ou fora dos maiores de cada linha, não chegam a ser alocados (veja OpcoesPoda).
+ *
+ * @param opcoes Poda do resultado; por padrão, todos os elementos não nulos são mantidos.
  */
-Matriz multiply(const Matriz &matrizA, const Matriz &matrizB)
+inline Matriz multiply(const Matriz &matrizA, const Matriz &matrizB, const OpcoesPoda &opcoes = {})
 {
-    // Verificação se a multiplicação é possível
-    if (matrizA.getColunas() != matrizB.getLinhas())
+    if (matrizA.getColunas() == matrizB.getLinhas() && !opcoes.ativa())
     {
-        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+        if (MatrizDiagonal::apenasDiagonalPrincipal(matrizA))
+            return multiply(MatrizDiagonal(matrizA), matrizB);
+
+        if (MatrizDiagonal::apenasDiagonalPrincipal(matrizB))
+            return multiply(matrizA, MatrizDiagonal(matrizB));
     }
 
-    // Criando a matriz resultante (C)
-    Matriz matriz(matrizA.getLinhas(), matrizB.getColunas());
+    EspacoProduto espaco;
+    return multiplicarEsparso(matrizA, matrizB, espaco, opcoes);
+}
 
-    // Percorrendo as linhas de matrizA e as colunas de matrizB
-    for (int i = 1, linha = matrizA.getLinhas(); i <= linha; i++)
-    {
-        for (int j = 1, coluna = matrizB.getColunas(); j <= coluna; j++)
-        {
-            double valor = 0;
+/**
+ * @brief Soma dois blocos de matrizes (ou uma matriz e um bloco) sem materializá-los.
+ *
+ * Matrizes convertem-se implicitamente em visões completas; veja somarVisoes().
+ *
+ * @throws std::invalid_argument Se os blocos não tiverem o mesmo tamanho.
+ */
+inline Matriz sum(const VisaoMatriz &visaoA, const VisaoMatriz &visaoB)
+{
+    return somarVisoes(visaoA, visaoB);
+}
 
-            // Calculando o produto escalar entre a linha i de A e a coluna j de B
-            for (int k = 1; k <= matrizA.getColunas(); k++)
-            {
-                valor += matrizA.get(i, k) * matrizB.get(k, j);
-            }
+/**
+ * @brief Multiplica dois blocos de matrizes (ou uma matriz e um bloco) sem materializá-los.
+ *
+ * Matrizes convertem-se implicitamente em visões completas; veja multiplicarEsparso(const VisaoMatriz &, const VisaoMatriz &, EspacoProduto &).
+ *
+ * @param opcoes Poda do resultado, como em multiply(const Matriz &, const Matriz &, const OpcoesPoda &).
+ * @throws std::invalid_argument Se o número de colunas de A for diferente do número de linhas de B.
+ */
+inline Matriz multiply(const VisaoMatriz &visaoA, const VisaoMatriz &visaoB, const OpcoesPoda &opcoes = {})
+{
+    EspacoProduto espaco;
+    return multiplicarEsparso(visaoA, visaoB, espaco, opcoes);
+}
 
-            matriz.insert(i, j, valor);
-        }
-    }
+/**
+ * @brief Multiplica a transposta de A por B (Aᵀ * B), sem construir Aᵀ.
+ *
+ * Útil para equações normais: as colunas de A são percorridas diretamente pelas ligações verticais.
+ *
+ * @param matrizA Matriz A (m x n).
+ * @param matrizB Matriz B (m x p).
+ * @return Matriz n x p com o resultado de Aᵀ * B.
+ * @throws std::invalid_argument Se A e B não tiverem o mesmo número de linhas.
+ */
+inline Matriz multiplyTransA(const Matriz &matrizA, const Matriz &matrizB)
+{
+    EspacoProduto espaco;
+    return multiplicarTranspostaA(matrizA, matrizB, espaco);
+}
 
-    return matriz; // Retorna a matriz resultante
+/**
+ * @brief Multiplica A pela transposta de B (A * Bᵀ), sem construir Bᵀ.
+ *
+ * @param matrizA Matriz A (m x n).
+ * @param matrizB Matriz B (p x n).
+ * @return Matriz m x p com o resultado de A * Bᵀ.
+ * @throws std::invalid_argument Se A e B não tiverem o mesmo número de colunas.
+ */
+inline Matriz multiplyTransB(const Matriz &matrizA, const Matriz &matrizB)
+{
+    EspacoProduto espaco;
+    return multiplicarTranspostaB(matrizA, matrizB, espaco);
+}
+
+/**
+ * @brief Calcula a matriz simétrica Aᵀ * A (matriz de Gram) computando apenas o triângulo superior.
+ *
+ * @param matriz Matriz A (m x n).
+ * @param apenasTrianguloSuperior Se verdadeiro, devolve só o triângulo superior (j >= i).
+ * @return Matriz n x n com Aᵀ * A.
+ */
+inline Matriz multiplyGram(const Matriz &matriz, bool apenasTrianguloSuperior = false)
+{
+    EspacoProduto espaco;
+    return multiplicarGram(matriz, espaco, apenasTrianguloSuperior);
 }
 
 #endif
\ No newline at end of file
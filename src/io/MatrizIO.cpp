@@ -0,0 +1,917 @@
+#include "io/MatrizIO.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <charconv>
+#include <exception>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    const char ASSINATURA_BINARIA[4] = {'M', 'E', 'S', 'P'}; /**< Identifica arquivos no formato binário. */
+    const uint32_t VERSAO_BINARIA = 1;                        /**< Versão do formato binário. */
+    const uint64_t BYTES_ELEMENTO_BINARIO = 2 * sizeof(int32_t) + sizeof(double); /**< Linha, coluna e valor de cada elemento. */
+
+    /**
+     * @brief Verifica se o caminho termina com a extensão informada.
+     */
+    bool temExtensao(const std::string &caminho, const std::string &extensao)
+    {
+        return caminho.size() >= extensao.size() &&
+               caminho.compare(caminho.size() - extensao.size(), extensao.size(), extensao) == 0;
+    }
+
+    const char ASSINATURA_COMPACTADA[4] = {'M', 'E', 'S', 'C'}; /**< Identifica arquivos no formato compactado. */
+    const uint32_t VERSAO_COMPACTADA = 1;                         /**< Versão do formato compactado. */
+    const std::size_t TAMANHO_BUFFER = 1 << 16;                   /**< Tamanho dos blocos lidos e escritos no formato compactado. */
+
+    /**
+     * @brief Acumula bytes em memória e os grava no arquivo em blocos.
+     */
+    class EscritorBuffer
+    {
+    private:
+        std::ofstream &file;
+        std::string buffer;
+
+    public:
+        explicit EscritorBuffer(std::ofstream &destino) : file(destino)
+        {
+            buffer.reserve(TAMANHO_BUFFER);
+        }
+
+        void bytes(const char *dados, std::size_t tamanho)
+        {
+            buffer.append(dados, tamanho);
+
+            if (buffer.size() >= TAMANHO_BUFFER)
+                descarregar();
+        }
+
+        /**
+         * @brief Grava um inteiro sem sinal em varint (7 bits por byte, bit alto indica continuação).
+         */
+        void varint(uint64_t valor)
+        {
+            char codificado[10];
+            std::size_t tamanho = 0;
+
+            while (valor >= 0x80)
+            {
+                codificado[tamanho++] = static_cast<char>((valor & 0x7F) | 0x80);
+                valor >>= 7;
+            }
+            codificado[tamanho++] = static_cast<char>(valor);
+
+            bytes(codificado, tamanho);
+        }
+
+        template <typename T>
+        void bruto(const T &valor)
+        {
+            bytes(reinterpret_cast<const char *>(&valor), sizeof(T));
+        }
+
+        void descarregar()
+        {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    };
+
+    /**
+     * @brief Lê o arquivo em blocos e entrega os bytes sob demanda.
+     */
+    class LeitorBuffer
+    {
+    private:
+        std::ifstream &file;
+        std::vector<char> buffer;
+        std::size_t posicao{0};
+        std::size_t disponivel{0};
+        uint64_t tamanho{0};   /**< Tamanho do arquivo em bytes. */
+        uint64_t entregues{0}; /**< Bytes já entregues por byte(). */
+
+    public:
+        explicit LeitorBuffer(std::ifstream &origem) : file(origem), buffer(TAMANHO_BUFFER)
+        {
+            file.seekg(0, std::ios::end);
+            const std::streamoff fim = file.tellg();
+            file.seekg(0, std::ios::beg);
+
+            if (fim > 0)
+                tamanho = static_cast<uint64_t>(fim);
+        }
+
+        /**
+         * @brief Bytes do arquivo que ainda não foram entregues.
+         */
+        uint64_t restantes() const
+        {
+            return tamanho > entregues ? tamanho - entregues : 0;
+        }
+
+        uint8_t byte()
+        {
+            if (posicao == disponivel)
+            {
+                file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                disponivel = static_cast<std::size_t>(file.gcount());
+                posicao = 0;
+
+                if (disponivel == 0)
+                    throw std::runtime_error("Erro: Arquivo compactado incompleto");
+            }
+
+            entregues++;
+            return static_cast<uint8_t>(buffer[posicao++]);
+        }
+
+        uint64_t varint()
+        {
+            uint64_t valor = 0;
+
+            for (int deslocamento = 0; deslocamento < 64; deslocamento += 7)
+            {
+                uint8_t b = byte();
+                valor |= static_cast<uint64_t>(b & 0x7F) << deslocamento;
+
+                if ((b & 0x80) == 0)
+                    return valor;
+            }
+
+            throw std::runtime_error("Erro: Varint inválido no arquivo compactado");
+        }
+
+        template <typename T>
+        void bruto(T &valor)
+        {
+            char *destino = reinterpret_cast<char *>(&valor);
+
+            for (std::size_t k = 0; k < sizeof(T); k++)
+                destino[k] = static_cast<char>(byte());
+        }
+    };
+
+    const double LIMITE_INTEIRO = 9007199254740992.0; /**< 2^53: maior magnitude em que todo inteiro é representável em double. */
+
+    /**
+     * @brief Indica se o valor pode ser gravado exatamente na codificação Inteiro.
+     */
+    bool valorInteiro(const double &valor)
+    {
+        return std::fabs(valor) < LIMITE_INTEIRO && std::trunc(valor) == valor;
+    }
+
+    /**
+     * @brief Mapeia inteiros com sinal para sem sinal (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...).
+     */
+    uint64_t zigueZague(int64_t valor)
+    {
+        return (static_cast<uint64_t>(valor) << 1) ^ static_cast<uint64_t>(valor >> 63);
+    }
+
+    int64_t desfazerZigueZague(uint64_t valor)
+    {
+        return static_cast<int64_t>(valor >> 1) ^ -static_cast<int64_t>(valor & 1);
+    }
+
+    const std::size_t BLOCO_MINIMO_MM = 1 << 20; /**< Tamanho mínimo (bytes) de cada bloco lido em paralelo. */
+
+    /**
+     * @brief Interpreta as linhas de elementos de um arquivo Matrix Market no intervalo [inicio, fim).
+     *
+     * @param padrao Se verdadeiro (campo "pattern"), as linhas não têm valor e recebem 1.
+     * @param saida Vetor onde os elementos lidos são acumulados.
+     *
+     * @throws std::runtime_error Se alguma linha estiver malformada.
+     */
+    void interpretarBlocoMM(const char *inicio, const char *fim, bool padrao, std::vector<Tripla> &saida)
+    {
+        auto espaco = [](char c)
+        { return c == ' ' || c == '\t' || c == '\r'; };
+
+        const char *p = inicio;
+
+        while (p < fim)
+        {
+            while (p < fim && espaco(*p))
+                p++;
+
+            if (p == fim)
+                break;
+
+            const char *linha = p;
+            const char *fimLinha = std::find(p, fim, '\n');
+
+            // Linhas vazias e comentários
+            if (*p == '\n' || *p == '%')
+            {
+                p = fimLinha + (fimLinha < fim);
+                continue;
+            }
+
+            int i{0}, j{0};
+            double valor{1.0};
+            bool valido = true;
+
+            auto r = std::from_chars(p, fimLinha, i);
+            valido = r.ec == std::errc();
+            p = r.ptr;
+
+            while (valido && p < fimLinha && espaco(*p))
+                p++;
+
+            if (valido)
+            {
+                r = std::from_chars(p, fimLinha, j);
+                valido = r.ec == std::errc();
+                p = r.ptr;
+            }
+
+            if (valido && !padrao)
+            {
+                while (p < fimLinha && espaco(*p))
+                    p++;
+
+                auto rv = std::from_chars(p, fimLinha, valor);
+                valido = rv.ec == std::errc();
+                p = rv.ptr;
+            }
+
+            while (valido && p < fimLinha && espaco(*p))
+                p++;
+
+            if (!valido || p != fimLinha)
+                throw std::runtime_error("Erro: Linha inválida no arquivo Matrix Market: \"" + std::string(linha, fimLinha) + "\"");
+
+            saida.push_back({i, j, valor});
+            p = fimLinha + (fimLinha < fim);
+        }
+    }
+
+    template <typename T>
+    void escreverBruto(std::ofstream &file, const T &valor)
+    {
+        file.write(reinterpret_cast<const char *>(&valor), sizeof(T));
+    }
+
+    template <typename T>
+    void lerBruto(std::ifstream &file, T &valor)
+    {
+        if (!file.read(reinterpret_cast<char *>(&valor), sizeof(T)))
+            throw std::runtime_error("Erro: Arquivo binário incompleto");
+    }
+}
+
+namespace
+{
+    /**
+     * @brief Monta o ConstrutorMatriz com os elementos de um arquivo texto.
+     */
+    ConstrutorMatriz carregarTexto(const std::string &caminho, std::atomic<int> *progresso)
+    {
+        std::ifstream file(caminho);
+
+        if (!file || !file.is_open())
+            throw std::runtime_error("Erro ao abrir o arquivo");
+
+        // Tamanho do arquivo, usado para estimar o progresso da leitura
+        file.seekg(0, std::ios::end);
+        const std::streamoff tamanho = file.tellg();
+        file.seekg(0, std::ios::beg);
+
+        int linhas{0}, colunas{0};
+        file >> linhas >> colunas;
+
+        ConstrutorMatriz construtor(linhas, colunas);
+
+        int i{0}, j{0};
+        double valor{0.0f};
+
+        while (file >> i >> j >> valor)
+        {
+            construtor.adicionar(i, j, valor);
+
+            if (progresso != nullptr && tamanho > 0 && construtor.quantidade() % 4096 == 0)
+                progresso->store(static_cast<int>(100 * file.tellg() / tamanho));
+        }
+
+        if (progresso != nullptr)
+            progresso->store(100);
+
+        return construtor;
+    }
+}
+
+Matriz lerMatrizTexto(const std::string &caminho, std::atomic<int> *progresso)
+{
+    return carregarTexto(caminho, progresso).construir();
+}
+
+void escreverMatrizTexto(const Matriz &matriz, const std::string &caminho)
+{
+    std::ofstream file(caminho);
+
+    if (!file || !file.is_open())
+        throw std::runtime_error("Erro ao criar o arquivo");
+
+    file << matriz.getLinhas() << " " << matriz.getColunas() << "\n";
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    for (ConstIteratorM it = matriz.begin(); it != matriz.end(); ++it)
+        file << it.linha() << " " << it.coluna() << " " << *it << "\n";
+}
+
+namespace
+{
+    /**
+     * @brief Monta o ConstrutorMatriz com os elementos de um arquivo binário.
+     */
+    ConstrutorMatriz carregarBinaria(const std::string &caminho)
+    {
+        std::ifstream file(caminho, std::ios::binary);
+
+        if (!file || !file.is_open())
+            throw std::runtime_error("Erro ao abrir o arquivo");
+
+        char assinatura[4];
+        uint32_t versao;
+        int32_t linhas, colunas;
+        uint64_t quantidade;
+
+        lerBruto(file, assinatura);
+        if (std::memcmp(assinatura, ASSINATURA_BINARIA, sizeof(assinatura)) != 0)
+            throw std::runtime_error("Erro: Arquivo não está no formato binário de matriz");
+
+        lerBruto(file, versao);
+        if (versao != VERSAO_BINARIA)
+            throw std::runtime_error("Erro: Versão de arquivo binário não suportada");
+
+        lerBruto(file, linhas);
+        lerBruto(file, colunas);
+        lerBruto(file, quantidade);
+
+        // A quantidade vem do arquivo: só reserva depois de conferi-la com os bytes que restam
+        const std::streamoff inicio = file.tellg();
+        file.seekg(0, std::ios::end);
+        const std::streamoff restantes = file.tellg() - inicio;
+        file.seekg(inicio, std::ios::beg);
+
+        if (inicio < 0 || restantes < 0 || quantidade > static_cast<uint64_t>(restantes) / BYTES_ELEMENTO_BINARIO ||
+            quantidade * BYTES_ELEMENTO_BINARIO != static_cast<uint64_t>(restantes))
+            throw std::runtime_error("Erro: Quantidade de elementos incompatível com o tamanho do arquivo binário");
+
+        ConstrutorMatriz construtor(linhas, colunas);
+        construtor.reservar(quantidade);
+
+        for (uint64_t k = 0; k < quantidade; k++)
+        {
+            int32_t i, j;
+            double valor;
+            lerBruto(file, i);
+            lerBruto(file, j);
+            lerBruto(file, valor);
+
+            construtor.adicionar(i, j, valor);
+        }
+
+        return construtor;
+    }
+}
+
+Matriz lerMatrizBinaria(const std::string &caminho)
+{
+    return carregarBinaria(caminho).construir();
+}
+
+void escreverMatrizBinaria(const Matriz &matriz, const std::string &caminho)
+{
+    std::ofstream file(caminho, std::ios::binary);
+
+    if (!file || !file.is_open())
+        throw std::runtime_error("Erro ao criar o arquivo");
+
+    const uint64_t quantidade = matriz.quantidade();
+
+    file.write(ASSINATURA_BINARIA, sizeof(ASSINATURA_BINARIA));
+    escreverBruto(file, VERSAO_BINARIA);
+    escreverBruto(file, static_cast<int32_t>(matriz.getLinhas()));
+    escreverBruto(file, static_cast<int32_t>(matriz.getColunas()));
+    escreverBruto(file, quantidade);
+
+    for (ConstIteratorM it = matriz.begin(); it != matriz.end(); ++it)
+    {
+        escreverBruto(file, static_cast<int32_t>(it.linha()));
+        escreverBruto(file, static_cast<int32_t>(it.coluna()));
+        escreverBruto(file, *it);
+    }
+
+    if (!file)
+        throw std::runtime_error("Erro ao escrever o arquivo");
+}
+
+namespace
+{
+    /**
+     * @brief Monta o ConstrutorMatriz com os elementos de um arquivo Matrix Market.
+     */
+    ConstrutorMatriz carregarMM(const std::string &caminho, unsigned threads)
+    {
+        std::ifstream file(caminho, std::ios::binary);
+
+        if (!file || !file.is_open())
+            throw std::runtime_error("Erro ao abrir o arquivo");
+
+        std::string conteudo;
+        file.seekg(0, std::ios::end);
+        conteudo.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(conteudo.data(), static_cast<std::streamsize>(conteudo.size()));
+
+        // Cabeçalho: %%MatrixMarket matrix coordinate <campo> <simetria>
+        std::size_t posicao = conteudo.find('\n');
+        std::istringstream cabecalho(conteudo.substr(0, posicao));
+        std::string banner, objeto, formato, campo, simetria;
+        cabecalho >> banner >> objeto >> formato >> campo >> simetria;
+
+        auto minusculas = [](std::string texto)
+        {
+            std::transform(texto.begin(), texto.end(), texto.begin(), [](unsigned char c)
+                           { return static_cast<char>(std::tolower(c)); });
+            return texto;
+        };
+        objeto = minusculas(objeto);
+        formato = minusculas(formato);
+        campo = minusculas(campo);
+        simetria = minusculas(simetria);
+
+        if (banner != "%%MatrixMarket" || objeto != "matrix")
+            throw std::runtime_error("Erro: Arquivo não está no formato Matrix Market");
+
+        if (formato != "coordinate" || (campo != "real" && campo != "integer" && campo != "pattern") ||
+            (simetria != "general" && simetria != "symmetric"))
+            throw std::runtime_error("Erro: Variante Matrix Market não suportada: " + formato + " " + campo + " " + simetria);
+
+        const bool padrao = campo == "pattern";
+        const bool simetrica = simetria == "symmetric";
+
+        // Comentários até a linha de tamanho: "linhas colunas elementos"
+        std::string linhaTamanho;
+        while (posicao != std::string::npos)
+        {
+            std::size_t inicio = posicao + 1;
+            posicao = conteudo.find('\n', inicio);
+            linhaTamanho = conteudo.substr(inicio, posicao == std::string::npos ? std::string::npos : posicao - inicio);
+
+            std::size_t primeiro = linhaTamanho.find_first_not_of(" \t\r");
+            if (primeiro != std::string::npos && linhaTamanho[primeiro] != '%')
+                break;
+
+            linhaTamanho.clear();
+        }
+
+        int linhas{0}, colunas{0};
+        long long declarados{-1};
+        std::istringstream tamanho(linhaTamanho);
+
+        if (!(tamanho >> linhas >> colunas >> declarados) || declarados < 0)
+            throw std::runtime_error("Erro: Linha de tamanho inválida no arquivo Matrix Market");
+
+        if (simetrica && linhas != colunas)
+            throw std::runtime_error("Erro: Matriz simétrica precisa ser quadrada");
+
+        ConstrutorMatriz construtor(linhas, colunas);
+
+        const char *corpo = conteudo.data() + (posicao == std::string::npos ? conteudo.size() : posicao + 1);
+        const char *fimCorpo = conteudo.data() + conteudo.size();
+        const std::size_t tamanhoCorpo = static_cast<std::size_t>(fimCorpo - corpo);
+
+        // A quantidade vem do arquivo: cada elemento ocupa ao menos 4 bytes ("i j\n", sem a última quebra
+        // de linha), então o corpo limita a reserva das partes
+        if (static_cast<unsigned long long>(declarados) > (tamanhoCorpo + 1) / 4)
+            throw std::runtime_error("Erro: Quantidade de elementos maior que o arquivo Matrix Market");
+
+        if (threads == 0)
+        {
+            const std::size_t porTamanho = std::max<std::size_t>(1, tamanhoCorpo / BLOCO_MINIMO_MM);
+            threads = static_cast<unsigned>(std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), porTamanho));
+        }
+
+        // Limites dos blocos, sempre logo após uma quebra de linha
+        std::vector<const char *> limites{corpo};
+        for (unsigned t = 1; t < threads; t++)
+        {
+            const char *corte = std::max(limites.back(), corpo + tamanhoCorpo * t / threads);
+            corte = std::find(corte, fimCorpo, '\n');
+            limites.push_back(corte + (corte < fimCorpo));
+        }
+        limites.push_back(fimCorpo);
+
+        std::vector<std::vector<Tripla>> partes(threads);
+        std::vector<std::exception_ptr> erros(threads);
+        std::vector<std::thread> trabalhadores;
+
+        for (unsigned t = 0; t < threads; t++)
+        {
+            partes[t].reserve(static_cast<std::size_t>(declarados) / threads + 1);
+
+            trabalhadores.emplace_back([&, t]()
+                                       {
+                                           try
+                                           {
+                                               interpretarBlocoMM(limites[t], limites[t + 1], padrao, partes[t]);
+                                           }
+                                           catch (...)
+                                           {
+                                               erros[t] = std::current_exception();
+                                           } });
+        }
+
+        for (std::thread &trabalhador : trabalhadores)
+            trabalhador.join();
+
+        for (const std::exception_ptr &erro : erros)
+            if (erro)
+                std::rethrow_exception(erro);
+
+        std::size_t lidos = 0;
+        for (const std::vector<Tripla> &parte : partes)
+            lidos += parte.size();
+
+        if (lidos != static_cast<std::size_t>(declarados))
+            throw std::runtime_error("Erro: Arquivo Matrix Market com " + std::to_string(lidos) + " elementos, esperados " + std::to_string(declarados));
+
+        construtor.reservar(simetrica ? 2 * lidos : lidos);
+
+        for (std::vector<Tripla> &parte : partes)
+        {
+            for (const Tripla &tripla : parte)
+            {
+                if (simetrica)
+                    construtor.adicionarSimetrico(tripla.linha, tripla.coluna, tripla.valor);
+                else
+                    construtor.adicionar(tripla.linha, tripla.coluna, tripla.valor);
+            }
+
+            std::vector<Tripla>().swap(parte);
+        }
+
+        return construtor;
+    }
+}
+
+Matriz lerMatrizMM(const std::string &caminho, unsigned threads)
+{
+    return carregarMM(caminho, threads).construir();
+}
+
+void escreverMatrizMM(const Matriz &matriz, const std::string &caminho, bool simetrica)
+{
+    std::vector<Tripla> elementos;
+    elementos.reserve(matriz.quantidade());
+
+    for (ConstIteratorM it = matriz.begin(); it != matriz.end(); ++it)
+        elementos.push_back({it.linha(), it.coluna(), *it});
+
+    if (simetrica)
+    {
+        if (matriz.getLinhas() != matriz.getColunas())
+            throw std::invalid_argument("Erro: Matriz simétrica precisa ser quadrada");
+
+        // A matriz é simétrica se a lista transposta, reordenada, for igual à original
+        std::vector<Tripla> transposta(elementos);
+        for (Tripla &tripla : transposta)
+            std::swap(tripla.linha, tripla.coluna);
+
+        std::sort(transposta.begin(), transposta.end(), [](const Tripla &a, const Tripla &b)
+                  { return a.linha < b.linha || (a.linha == b.linha && a.coluna < b.coluna); });
+
+        bool igual = std::equal(elementos.begin(), elementos.end(), transposta.begin(), [](const Tripla &a, const Tripla &b)
+                                { return a.linha == b.linha && a.coluna == b.coluna && a.valor == b.valor; });
+
+        if (!igual)
+            throw std::invalid_argument("Erro: A matriz não é simétrica");
+
+        elementos.erase(std::remove_if(elementos.begin(), elementos.end(), [](const Tripla &tripla)
+                                       { return tripla.coluna > tripla.linha; }),
+                        elementos.end());
+    }
+
+    std::ofstream file(caminho);
+
+    if (!file || !file.is_open())
+        throw std::runtime_error("Erro ao criar o arquivo");
+
+    file << "%%MatrixMarket matrix coordinate real " << (simetrica ? "symmetric" : "general") << "\n";
+    file << matriz.getLinhas() << " " << matriz.getColunas() << " " << elementos.size() << "\n";
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    for (const Tripla &tripla : elementos)
+        file << tripla.linha << " " << tripla.coluna << " " << tripla.valor << "\n";
+
+    if (!file)
+        throw std::runtime_error("Erro ao escrever o arquivo");
+}
+
+void escreverMatrizCompactada(const Matriz &matriz, const std::string &caminho, ValoresCompactados valores)
+{
+    uint64_t quantidade = 0;
+    std::vector<double> dicionario;
+    std::unordered_map<uint64_t, uint32_t> indices; // Padrão de bits do valor -> posição no dicionário
+
+    const bool montarDicionario = valores == ValoresCompactados::Automatico || valores == ValoresCompactados::Dicionario;
+    bool dicionarioViavel = montarDicionario;
+    bool inteiros = true;
+
+    for (ConstIteratorM it = matriz.begin(); it != matriz.end(); ++it)
+    {
+        quantidade++;
+        inteiros = inteiros && valorInteiro(*it);
+
+        if (!dicionarioViavel)
+            continue;
+
+        uint64_t bits;
+        const double valor = *it;
+        std::memcpy(&bits, &valor, sizeof(bits));
+
+        if (indices.emplace(bits, static_cast<uint32_t>(dicionario.size())).second)
+            dicionario.push_back(valor);
+
+        // No modo automático, o dicionário só compensa com poucos valores distintos
+        if (valores == ValoresCompactados::Automatico && dicionario.size() > 256 && dicionario.size() * 4 > quantidade)
+            dicionarioViavel = false;
+    }
+
+    if (valores == ValoresCompactados::Automatico)
+    {
+        if (inteiros)
+            valores = ValoresCompactados::Inteiro;
+        else if (dicionarioViavel && dicionario.size() * 4 <= quantidade)
+            valores = ValoresCompactados::Dicionario;
+        else
+            valores = ValoresCompactados::Double;
+    }
+
+    if (valores == ValoresCompactados::Inteiro && !inteiros)
+        throw std::invalid_argument("Erro: A matriz possui valores não inteiros");
+
+    std::ofstream file(caminho, std::ios::binary);
+
+    if (!file || !file.is_open())
+        throw std::runtime_error("Erro ao criar o arquivo");
+
+    EscritorBuffer escritor(file);
+
+    escritor.bytes(ASSINATURA_COMPACTADA, sizeof(ASSINATURA_COMPACTADA));
+    escritor.bruto(VERSAO_COMPACTADA);
+    escritor.bruto(static_cast<uint8_t>(valores));
+    escritor.bruto(static_cast<int32_t>(matriz.getLinhas()));
+    escritor.bruto(static_cast<int32_t>(matriz.getColunas()));
+    escritor.bruto(quantidade);
+
+    if (valores == ValoresCompactados::Dicionario)
+    {
+        escritor.varint(dicionario.size());
+        for (const double &valor : dicionario)
+            escritor.bruto(valor);
+    }
+
+    int linhaAnterior = 0;
+
+    for (int i = 1; i <= matriz.getLinhas(); i++)
+    {
+        const Node *sentinela = matriz.getSentinelaLinha(i);
+
+        if (sentinela->direita == sentinela)
+            continue;
+
+        uint64_t elementos = 0;
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+            elementos++;
+
+        escritor.varint(static_cast<uint64_t>(i - linhaAnterior));
+        escritor.varint(elementos);
+        linhaAnterior = i;
+
+        int colunaAnterior = 0;
+
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+        {
+            escritor.varint(static_cast<uint64_t>(no->coluna - colunaAnterior));
+            colunaAnterior = no->coluna;
+
+            switch (valores)
+            {
+            case ValoresCompactados::Float:
+                escritor.bruto(static_cast<float>(no->valor));
+                break;
+
+            case ValoresCompactados::Dicionario:
+            {
+                uint64_t bits;
+                std::memcpy(&bits, &no->valor, sizeof(bits));
+                escritor.varint(indices.at(bits));
+                break;
+            }
+
+            case ValoresCompactados::Inteiro:
+                escritor.varint(zigueZague(static_cast<int64_t>(no->valor)));
+                break;
+
+            default:
+                escritor.bruto(no->valor);
+                break;
+            }
+        }
+    }
+
+    escritor.descarregar();
+
+    if (!file)
+        throw std::runtime_error("Erro ao escrever o arquivo");
+}
+
+namespace
+{
+    /**
+     * @brief Monta o ConstrutorMatriz com os elementos de um arquivo compactado.
+     */
+    ConstrutorMatriz carregarCompactada(const std::string &caminho)
+    {
+        std::ifstream file(caminho, std::ios::binary);
+
+        if (!file || !file.is_open())
+            throw std::runtime_error("Erro ao abrir o arquivo");
+
+        LeitorBuffer leitor(file);
+
+        char assinatura[4];
+        uint32_t versao;
+        uint8_t codificacao;
+        int32_t linhas, colunas;
+        uint64_t quantidade;
+
+        leitor.bruto(assinatura);
+        if (std::memcmp(assinatura, ASSINATURA_COMPACTADA, sizeof(assinatura)) != 0)
+            throw std::runtime_error("Erro: Arquivo não está no formato compactado de matriz");
+
+        leitor.bruto(versao);
+        if (versao != VERSAO_COMPACTADA)
+            throw std::runtime_error("Erro: Versão de arquivo compactado não suportada");
+
+        leitor.bruto(codificacao);
+        const ValoresCompactados valores = static_cast<ValoresCompactados>(codificacao);
+
+        if (valores != ValoresCompactados::Double && valores != ValoresCompactados::Float &&
+            valores != ValoresCompactados::Dicionario && valores != ValoresCompactados::Inteiro)
+            throw std::runtime_error("Erro: Codificação de valores desconhecida no arquivo compactado");
+
+        leitor.bruto(linhas);
+        leitor.bruto(colunas);
+        leitor.bruto(quantidade);
+
+        // Quantidades vêm do arquivo: cada elemento ocupa ao menos um byte e cada entrada do dicionário
+        // um double, então o que resta do arquivo limita as reservas
+        if (quantidade > leitor.restantes())
+            throw std::runtime_error("Erro: Quantidade de elementos maior que o arquivo compactado");
+
+        ConstrutorMatriz construtor(linhas, colunas);
+        construtor.reservar(quantidade);
+
+        std::vector<double> dicionario;
+        if (valores == ValoresCompactados::Dicionario)
+        {
+            const uint64_t entradas = leitor.varint();
+            if (entradas > leitor.restantes() / sizeof(double))
+                throw std::runtime_error("Erro: Dicionário maior que o arquivo compactado");
+
+            dicionario.resize(entradas);
+            for (double &valor : dicionario)
+                leitor.bruto(valor);
+        }
+
+        uint64_t lidos = 0;
+        int64_t linha = 0;
+
+        while (lidos < quantidade)
+        {
+            linha += static_cast<int64_t>(leitor.varint());
+            const uint64_t elementos = leitor.varint();
+
+            if (linha > linhas || elementos == 0 || elementos > quantidade - lidos)
+                throw std::runtime_error("Erro: Linha inválida no arquivo compactado");
+
+            int64_t coluna = 0;
+
+            for (uint64_t k = 0; k < elementos; k++)
+            {
+                coluna += static_cast<int64_t>(leitor.varint());
+
+                if (coluna > colunas)
+                    throw std::runtime_error("Erro: Coluna inválida no arquivo compactado");
+
+                double valor;
+
+                switch (valores)
+                {
+                case ValoresCompactados::Float:
+                {
+                    float reduzido;
+                    leitor.bruto(reduzido);
+                    valor = reduzido;
+                    break;
+                }
+
+                case ValoresCompactados::Dicionario:
+                {
+                    const uint64_t indice = leitor.varint();
+
+                    if (indice >= dicionario.size())
+                        throw std::runtime_error("Erro: Índice de dicionário inválido no arquivo compactado");
+
+                    valor = dicionario[indice];
+                    break;
+                }
+
+                case ValoresCompactados::Inteiro:
+                    valor = static_cast<double>(desfazerZigueZague(leitor.varint()));
+                    break;
+
+                default:
+                    leitor.bruto(valor);
+                    break;
+                }
+
+                construtor.adicionar(static_cast<int>(linha), static_cast<int>(coluna), valor);
+            }
+
+            lidos += elementos;
+        }
+
+        return construtor;
+    }
+}
+
+Matriz lerMatrizCompactada(const std::string &caminho)
+{
+    return carregarCompactada(caminho).construir();
+}
+
+namespace
+{
+    /**
+     * @brief Monta o ConstrutorMatriz escolhendo o formato pela extensão do arquivo.
+     */
+    ConstrutorMatriz carregar(const std::string &caminho)
+    {
+        if (temExtensao(caminho, ".bin"))
+            return carregarBinaria(caminho);
+
+        if (temExtensao(caminho, ".mtx"))
+            return carregarMM(caminho, 0);
+
+        if (temExtensao(caminho, ".mec"))
+            return carregarCompactada(caminho);
+
+        return carregarTexto(caminho, nullptr);
+    }
+}
+
+Matriz lerMatriz(const std::string &caminho)
+{
+    return carregar(caminho).construir();
+}
+
+std::variant<Matriz, MatrizDiagonal> lerMatrizAdaptativa(const std::string &caminho, const double &preenchimentoMinimo)
+{
+    ConstrutorMatriz construtor = carregar(caminho);
+
+    // Estrutura em faixas: os elementos vão direto para os vetores das diagonais, sem criar nós
+    if (std::optional<MatrizDiagonal> diagonal = MatrizDiagonal::detectar(construtor, preenchimentoMinimo))
+        return std::move(*diagonal);
+
+    return construtor.construir();
+}
+
+void escreverMatriz(const Matriz &matriz, const std::string &caminho)
+{
+    if (temExtensao(caminho, ".bin"))
+        escreverMatrizBinaria(matriz, caminho);
+    else if (temExtensao(caminho, ".mtx"))
+        escreverMatrizMM(matriz, caminho);
+    else if (temExtensao(caminho, ".mec"))
+        escreverMatrizCompactada(matriz, caminho);
+    else
+        escreverMatrizTexto(matriz, caminho);
+}
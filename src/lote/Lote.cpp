@@ -0,0 +1,290 @@
+#include "lote/Lote.hpp"
+#include "io/MatrizIO.hpp"
+#include "utils/utils.hpp"
+#include "registro/RegistroMatrizes.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <iomanip>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+    /**
+     * @brief Passo do modo lote já interpretado.
+     */
+    struct Passo
+    {
+        std::string comando;                /**< load, save, sum, mul, info ou budget. */
+        std::string destino;                /**< Nome da matriz criada, gravada ou exibida; orçamento em MiB para budget. */
+        std::vector<std::string> operandos; /**< Caminho do arquivo (load/save) ou nomes das matrizes (sum/mul). */
+        std::string origem;                 /**< Texto original do passo, usado nas mensagens. */
+    };
+
+    /**
+     * @brief Separa "NOME=valor" em suas duas partes.
+     *
+     * @throws std::invalid_argument Se não houver '=' ou uma das partes estiver vazia.
+     */
+    std::pair<std::string, std::string> separarAtribuicao(const std::string &texto)
+    {
+        const std::size_t igual = texto.find('=');
+
+        if (igual == std::string::npos || igual == 0 || igual + 1 == texto.size())
+            throw std::invalid_argument("Erro: Esperado NOME=valor em \"" + texto + "\"");
+
+        return {texto.substr(0, igual), texto.substr(igual + 1)};
+    }
+
+    /**
+     * @brief Interpreta um passo a partir do comando e do seu argumento.
+     *
+     * @throws std::invalid_argument Se o comando for desconhecido ou o argumento estiver malformado.
+     */
+    Passo interpretarPasso(const std::string &comando, const std::string &argumento)
+    {
+        Passo passo{comando, "", {}, comando + " " + argumento};
+
+        if (comando == "load" || comando == "save")
+        {
+            auto [nome, caminho] = separarAtribuicao(argumento);
+            passo.destino = nome;
+            passo.operandos = {caminho};
+        }
+        else if (comando == "sum" || comando == "mul")
+        {
+            auto [nome, operandos] = separarAtribuicao(argumento);
+            const std::size_t virgula = operandos.find(',');
+
+            if (virgula == std::string::npos || virgula == 0 || virgula + 1 == operandos.size())
+                throw std::invalid_argument("Erro: Esperado C=A,B em \"" + argumento + "\"");
+
+            passo.destino = nome;
+            passo.operandos = {operandos.substr(0, virgula), operandos.substr(virgula + 1)};
+        }
+        else if (comando == "prune")
+        {
+            auto [nome, criterios] = separarAtribuicao(argumento);
+            const std::size_t virgula = criterios.find(',');
+            const std::string tolerancia = criterios.substr(0, virgula);
+            const std::string maximo = virgula == std::string::npos ? "0" : criterios.substr(virgula + 1);
+
+            std::size_t lidos = 0;
+            bool valido = !tolerancia.empty() && !maximo.empty() && maximo.find_first_not_of("0123456789") == std::string::npos;
+            try
+            {
+                valido = valido && std::stod(tolerancia, &lidos) >= 0 && lidos == tolerancia.size();
+            }
+            catch (const std::exception &)
+            {
+                valido = false;
+            }
+
+            if (!valido)
+                throw std::invalid_argument("Erro: Esperado NOME=TOL ou NOME=TOL,K em \"" + argumento + "\"");
+
+            passo.destino = nome;
+            passo.operandos = {tolerancia, maximo};
+        }
+        else if (comando == "info")
+        {
+            if (argumento.empty())
+                throw std::invalid_argument("Erro: Esperado o nome da matriz em \"info\"");
+
+            passo.destino = argumento;
+        }
+        else if (comando == "budget")
+        {
+            if (argumento.empty() || argumento.find_first_not_of("0123456789") != std::string::npos)
+                throw std::invalid_argument("Erro: Esperado o orçamento em MiB em \"budget\"");
+
+            passo.destino = argumento;
+        }
+        else
+        {
+            throw std::invalid_argument("Erro: Comando desconhecido \"" + comando + "\"");
+        }
+
+        return passo;
+    }
+
+    void lerScript(const std::string &caminho, std::vector<Passo> &passos, int profundidade);
+
+    /**
+     * @brief Acrescenta a \p passos o passo (ou os passos de um script) descrito por comando e argumento.
+     */
+    void adicionarPasso(const std::string &comando, const std::string &argumento, std::vector<Passo> &passos, int profundidade)
+    {
+        if (comando == "script")
+            lerScript(argumento, passos, profundidade + 1);
+        else
+            passos.push_back(interpretarPasso(comando, argumento));
+    }
+
+    /**
+     * @brief Lê os passos de um arquivo de script, um por linha.
+     *
+     * @throws std::runtime_error Se o arquivo não puder ser aberto ou os scripts se incluírem indefinidamente.
+     */
+    void lerScript(const std::string &caminho, std::vector<Passo> &passos, int profundidade)
+    {
+        if (profundidade > 16)
+            throw std::runtime_error("Erro: Scripts aninhados demais em \"" + caminho + "\"");
+
+        std::ifstream file(caminho);
+
+        if (!file || !file.is_open())
+            throw std::runtime_error("Erro ao abrir o script \"" + caminho + "\"");
+
+        std::string linha;
+        int numero = 0;
+
+        while (std::getline(file, linha))
+        {
+            numero++;
+
+            std::istringstream campos(linha);
+            std::string comando, argumento, sobra;
+
+            if (!(campos >> comando) || comando[0] == '#')
+                continue;
+
+            campos >> argumento;
+
+            if (campos >> sobra && sobra[0] != '#')
+                throw std::invalid_argument("Erro: " + caminho + ":" + std::to_string(numero) + ": argumento inesperado \"" + sobra + "\"");
+
+            try
+            {
+                adicionarPasso(comando, argumento, passos, profundidade);
+            }
+            catch (const std::invalid_argument &e)
+            {
+                throw std::invalid_argument(caminho + ":" + std::to_string(numero) + ": " + e.what());
+            }
+        }
+    }
+
+    /**
+     * @brief Interpreta os argumentos da linha de comando no formato "--comando argumento".
+     */
+    std::vector<Passo> interpretarArgumentos(const std::vector<std::string> &argumentos)
+    {
+        std::vector<Passo> passos;
+
+        for (std::size_t k = 0; k < argumentos.size(); k++)
+        {
+            const std::string &opcao = argumentos[k];
+
+            if (opcao.size() < 3 || opcao.compare(0, 2, "--") != 0)
+                throw std::invalid_argument("Erro: Opção inválida \"" + opcao + "\"");
+
+            if (k + 1 == argumentos.size())
+                throw std::invalid_argument("Erro: Falta o argumento de \"" + opcao + "\"");
+
+            adicionarPasso(opcao.substr(2), argumentos[++k], passos, 0);
+        }
+
+        return passos;
+    }
+
+    /**
+     * @brief Executa um passo, guardando ou consultando as matrizes em \p matrizes.
+     *
+     * Matrizes despejadas para o disco pelo orçamento do registro são recarregadas por obter().
+     */
+    void executarPasso(const Passo &passo, RegistroMatrizes &matrizes, std::ostream &saida)
+    {
+        if (passo.comando == "load")
+        {
+            matrizes.definir(passo.destino, lerMatriz(passo.operandos[0]));
+        }
+        else if (passo.comando == "save")
+        {
+            escreverMatriz(matrizes.obter(passo.destino), passo.operandos[0]);
+        }
+        else if (passo.comando == "sum")
+        {
+            Matriz resultado = sum(matrizes.obter(passo.operandos[0]), matrizes.obter(passo.operandos[1]));
+            matrizes.definir(passo.destino, resultado);
+        }
+        else if (passo.comando == "mul")
+        {
+            Matriz resultado = multiply(matrizes.obter(passo.operandos[0]), matrizes.obter(passo.operandos[1]));
+            matrizes.definir(passo.destino, resultado);
+        }
+        else if (passo.comando == "prune")
+        {
+            Matriz matriz = matrizes.obter(passo.destino);
+            const size_t removidos = matriz.prune(std::stod(passo.operandos[0]), std::stoull(passo.operandos[1]));
+            matrizes.definir(passo.destino, matriz);
+
+            saida << passo.destino << ": " << removidos << " elementos removidos" << '\n';
+        }
+        else if (passo.comando == "info")
+        {
+            // O resumo do registro dispensa recarregar uma matriz que esteja no disco
+            const InfoRegistro info = matrizes.resumo(passo.destino);
+            saida << info.nome << ": " << info.linhas << "x" << info.colunas
+                  << ", " << info.quantidade << " elementos não nulos" << '\n';
+        }
+        else if (passo.comando == "budget")
+        {
+            matrizes.setOrcamento(std::stoull(passo.destino) * 1024 * 1024);
+        }
+    }
+}
+
+int executarLote(const std::vector<std::string> &argumentos, std::ostream &saida)
+{
+    std::vector<Passo> passos;
+
+    try
+    {
+        passos = interpretarArgumentos(argumentos);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    RegistroMatrizes matrizes;
+    double total = 0.0;
+
+    saida << std::fixed << std::setprecision(3);
+
+    for (const Passo &passo : passos)
+    {
+        auto inicio = std::chrono::steady_clock::now();
+
+        try
+        {
+            executarPasso(passo, matrizes, saida);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Falha em \"" << passo.origem << "\": " << e.what() << '\n';
+            return 1;
+        }
+
+        auto fim = std::chrono::steady_clock::now();
+        double duracao = std::chrono::duration<double, std::milli>(fim - inicio).count();
+        total += duracao;
+
+        saida << passo.origem << ": " << duracao << " ms" << '\n';
+    }
+
+    saida << "total: " << total << " ms" << std::endl;
+
+    if (matrizes.getOrcamento() != 0)
+    {
+        const EstatisticasRegistro &uso = matrizes.getEstatisticas();
+        saida << "registro: " << uso.acertos << " acertos, " << uso.faltas << " faltas, "
+              << uso.despejos << " despejos, " << uso.gravacoes << " gravações" << std::endl;
+    }
+
+    return 0;
+}
@@ -6,12 +6,32 @@
 
 #include <fstream>
 #include <unordered_map>
+#include <future>
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
 #include "matriz/Matriz.hpp"
 #include "utils/utils.hpp"
 #include "manipMatriz/manipMatriz.hpp"
+#include "io/MatrizIO.hpp"
+#include "lote/Lote.hpp"
+#include "registro/RegistroMatrizes.hpp"
+#include "registro/CacheResultados.hpp"
 
 using string = std::string;
-using unordered_map = std::unordered_map<string, Matriz>;
+
+/**
+ * @brief Leitura de matriz em andamento em segundo plano.
+ */
+struct Carregamento
+{
+    std::future<Matriz> futuro;                  /**< Resultado da leitura, disponível quando a thread termina. */
+    std::shared_ptr<std::atomic<int>> progresso; /**< Percentual (0 a 100) do arquivo já processado. */
+};
+
+using carregamentos = std::unordered_map<string, Carregamento>;
 
 enum Opcoes // Enumeração para as opções do menu
 {
@@ -32,6 +52,7 @@ enum Opcoes // Enumeração para as opções do menu
  *
  * @param matriz Referência para o objeto Matriz que será inicializado e populado.
  * @param filename Nome do arquivo a ser lido (sem o caminho completo).
+ * @param progresso Se informado, recebe periodicamente o percentual (0 a 100) do arquivo já lido.
  *
  * @throws std::runtime_error Quando não é possível acessar ou abrir o arquivo.
  *
@@ -41,26 +62,56 @@ enum Opcoes // Enumeração para as opções do menu
  * - Os primeiros valores lidos do arquivo correspondem ao número de linhas
  *   (\p linhas) e de colunas (\p colunas) para inicializar corretamente a matriz.
  * - Em seguida, cada conjunto de três valores (índice de linha, índice de
- *   coluna e valor) é lido e inserido na matriz usando \c matriz.insert().
+ *   coluna e valor) é lido e a matriz é montada por lerMatrizTexto().
  * - Caso o arquivo não seja encontrado ou ocorra algum outro problema,
  *   é gerada uma exceção do tipo \c std::runtime_error.
  */
-void readMatrix(Matriz &matriz, const std::string filename);
+void readMatrix(Matriz &matriz, const std::string filename, std::atomic<int> *progresso = nullptr);
+
+/**
+ * @brief Inicia a leitura de um arquivo de matriz em segundo plano.
+ *
+ * A leitura é executada por std::async em uma thread própria, de modo que vários arquivos podem
+ * ser carregados ao mesmo tempo em núcleos diferentes enquanto o menu continua respondendo.
+ *
+ * @param filename Nome do arquivo a ser lido (sem o caminho completo).
+ * @param pendentes Leituras em andamento, onde a nova leitura é registrada.
+ */
+void iniciarCarregamento(const string &filename, carregamentos &pendentes);
+
+/**
+ * @brief Move para o mapa de matrizes as leituras em segundo plano que já terminaram.
+ *
+ * Leituras que falharam são removidas e o erro é exibido.
+ *
+ * @param matrizes Mapa de matrizes prontas.
+ * @param pendentes Leituras em andamento.
+ */
+void coletarCarregamentos(RegistroMatrizes &matrizes, carregamentos &pendentes);
+
+/**
+ * @brief Garante que a matriz está pronta para uso, aguardando sua leitura se ainda estiver em andamento.
+ *
+ * @param filename Nome da matriz.
+ * @param matrizes Mapa de matrizes prontas.
+ * @param pendentes Leituras em andamento.
+ * @return Retorna \c true se a matriz existir (já carregada ou recém concluída); caso contrário, \c false.
+ */
+bool aguardarMatriz(const string &filename, RegistroMatrizes &matrizes, carregamentos &pendentes);
 
 /**
- * @brief Verifica se existe uma matriz previamente armazenada em um \c unordered_map.
+ * @brief Verifica se existe uma matriz previamente armazenada no registro.
  *
- * Esta função realiza uma busca no \c unordered_map pelo nome do arquivo (\p filename)
+ * Esta função realiza uma busca no registro pelo nome do arquivo (\p filename)
  * para determinar se já existe uma matriz associada a ele.
  *
  * @param filename O nome do arquivo cujo registro de matriz deve ser verificado.
- * @param matrizes O \c unordered_map que mantém o mapeamento entre nomes de arquivos e matrizes.
+ * @param matrizes O registro que mantém o mapeamento entre nomes de arquivos e matrizes.
  * @return Retorna \c true se existir a matriz correspondente ao nome do arquivo; caso contrário, \c false.
  *
- * @note O uso do \c unordered_map permite que a busca ocorra de maneira eficiente,
- * pois a busca possui complexidade média O(1).
+ * @note A busca não carrega matrizes despejadas para o disco e possui complexidade média O(1).
  */
-bool existeMatriz(const std::string filename, const unordered_map &matrizes);
+bool existeMatriz(const std::string filename, const RegistroMatrizes &matrizes);
 
 /**
  * @brief Salva uma matriz em um mapa associativo de matrizes, permitindo que seja recuperada posteriormente.
@@ -72,12 +123,12 @@ bool existeMatriz(const std::string filename, const unordered_map &matrizes);
  * com a chave fornecida pelo usuário, e é exibida uma mensagem de confirmação.
  *
  * @param matriz Objeto do tipo Matriz que será salvo.
- * @param matrizes Estrutura (unordered_map) onde a matriz será armazenada, associada a um nome (string).
+ * @param matrizes Registro onde a matriz será armazenada, associada a um nome (string).
  *
  * @note Essa função não retorna valores. É importante que o usuário insira corretamente as opções (s ou n) para prosseguir ou cancelar
  *       o salvamento, e que forneça um nome válido quando optar por salvar a matriz.
  */
-void salvarMatriz(const Matriz &matriz, unordered_map &matrizes);
+void salvarMatriz(const Matriz &matriz, RegistroMatrizes &matrizes);
 
 /**
  * @brief Solicita ao usuário o nome de duas matrizes a serem processadas.
@@ -88,23 +139,34 @@ void salvarMatriz(const Matriz &matriz, unordered_map &matrizes);
 void escolherMatrizes(string &filename, string &filename2);
 
 /**
- * @brief Exibe informações sobre as matrizes armazenadas em um std::unordered_map.
+ * @brief Exibe informações sobre as matrizes armazenadas no registro.
  *
- * @param matrizes Um std::unordered_map que mapeia uma chave (nome da matriz) para
- *                 uma instância de uma classe que fornece métodos getLinhas() e getColunas().
+ * @param matrizes Registro de matrizes; as despejadas para o disco são exibidas sem serem recarregadas.
+ * @param pendentes Leituras em andamento, exibidas como "carregando (x%)".
  *
- * As dimensões exibidas são obtidas diretamente da instância armazenada em cada valor do map.
+ * As dimensões exibidas vêm do resumo mantido pelo registro para cada matriz, e, com um orçamento
+ * de memória, também os acertos, faltas e despejos do registro.
  * A exibição é formatada para melhor leitura e compreensão dos dados de cada matriz.
  */
-void printMatrizes(const unordered_map &matrizes);
+void printMatrizes(const RegistroMatrizes &matrizes, const carregamentos &pendentes);
+
+/**
+ * @brief Lê o orçamento de memória do registro, em MiB, da variável de ambiente MATRIZ_ORCAMENTO_MB.
+ *
+ * @return O orçamento em bytes, ou 0 (sem limite) se a variável não existir ou não for um número positivo.
+ */
+size_t orcamentoRegistro();
 
 /**
  * @file main.cpp
  * @brief Programa para manipulação de matrizes esparsas.
  *
  * Este programa permite ao usuário ler, imprimir, somar e multiplicar matrizes esparsas.
- * As matrizes são armazenadas em um mapa associativo, onde a chave é o nome do arquivo
- * e o valor é a matriz correspondente.
+ * As matrizes são armazenadas em um RegistroMatrizes, onde a chave é o nome do arquivo
+ * e o valor é a matriz correspondente. Com a variável de ambiente MATRIZ_ORCAMENTO_MB, as matrizes
+ * menos usadas são despejadas para o disco quando a memória passa do orçamento. Somas e multiplicações
+ * repetidas sobre operandos inalterados são respondidas por um CacheResultados, que fica com um quarto
+ * do orçamento.
  *
  * @details
  * O programa apresenta um menu interativo com as seguintes opções:
@@ -113,20 +175,41 @@ void printMatrizes(const unordered_map &matrizes);
  * - Somar Matrizes: Soma duas matrizes armazenadas.
  * - Multiplicar Matrizes: Multiplica duas matrizes armazenadas.
  * - Sair: Encerra o programa.
+ *
+ * Quando chamado com argumentos, o programa executa no modo lote (veja Lote.hpp) e não exibe o menu:
+ * @code
+ * Matriz-Esparsa --load A=m1.txt --load B=m2.txt --mul C=A,B --save C=out.bin
+ * @endcode
  */
-int main()
+int main(int argc, char **argv)
 {
     // Configura a localização para suportar caracteres especiais em português
     setlocale(LC_ALL, "pt_BR.UTF-8");
 
+    // Modo lote: executa os passos da linha de comando sem menu e sem chamadas ao shell
+    if (argc > 1)
+        return executarLote(std::vector<std::string>(argv + 1, argv + argc), std::cout);
+
     std::cout << "Bem-vindo ao programa de manipulação de matrizes esparsas" << std::endl;
     std::cout << "-----------------------------------------------------------" << std::endl;
 
-    // Mapa associativo para armazenar as matrizes
-    unordered_map matrizes;
+    // Com orçamento de memória, um quarto dele fica com o cache de resultados e o restante com o registro:
+    // um resultado guardado no cache não é liberado quando o registro despeja a cópia salva dele, então
+    // os dois limites juntos respeitam o orçamento
+    const size_t orcamento = orcamentoRegistro();
+    const size_t orcamentoCache = orcamento / 4;
+
+    // Registro das matrizes, com despejo para o disco se houver orçamento de memória
+    RegistroMatrizes matrizes(orcamento - orcamentoCache);
+    // Resultados recentes de soma e multiplicação; editar um operando muda a sua versão e invalida a entrada
+    CacheResultados resultados(8, orcamentoCache);
+    // Leituras de arquivos em andamento
+    carregamentos pendentes;
 
     while (true)
     {
+        coletarCarregamentos(matrizes, pendentes);
+
         // Exibe o menu de opções
         std::cout << "Escolha uma opção:" << std::endl;
         std::cout << "[1] - Ler Matriz" << std::endl;
@@ -143,59 +226,61 @@ int main()
         {
         case LER_MATRIZ:
         {
-            // Lê uma matriz a partir de um arquivo
-            string filename;
-            std::cout << "Digite o nome do arquivo: ";
-            std::getline(std::cin, filename);
+            // Lê uma ou mais matrizes a partir de arquivos, em segundo plano
+            string linha;
+            std::cout << "Digite o nome do arquivo (ou vários, separados por espaço): ";
+            std::getline(std::cin, linha);
 
-            Matriz matriz;
-
-            try
+            std::istringstream nomes(linha);
+            string filename;
+            while (nomes >> filename)
             {
-                readMatrix(matriz, filename);
+                if (existeMatriz(filename, matrizes) || pendentes.count(filename))
+                {
+                    std::cout << "A matriz " << filename << " já foi carregada" << std::endl;
+                    continue;
+                }
+
+                iniciarCarregamento(filename, pendentes);
+                std::cout << "Carregando " << filename << " em segundo plano" << std::endl;
             }
-            catch (const std::exception &e)
-            {
-                std::cerr << e.what() << '\n';
-                std::cout << "Exemplo de arquivo: matrix.txt" << std::endl;
-                break;
-            }
-
-            // Armazena a matriz no mapa associativo
-            matrizes.insert(std::make_pair(filename, matriz));
             break;
         }
 
         case MANIPULAR_MATRIZ:
         {
-            if (matrizes.empty())
+            if (matrizes.empty() && pendentes.empty())
             {
                 std::cout << "Não há matrizes armazenadas" << std::endl;
                 break;
             }
 
             // Manipula uma matriz armazenada
-            printMatrizes(matrizes);
+            printMatrizes(matrizes, pendentes);
 
             std::cout << "Qual matriz deseja manipular?" << std::endl;
             string filename;
             std::getline(std::cin, filename);
 
-            if (!existeMatriz(filename, matrizes))
+            if (!aguardarMatriz(filename, matrizes, pendentes))
             {
                 std::cout << "Matriz não encontrada" << std::endl;
                 break;
             }
 
             std::system("clear||cls");
-            manipMatrix(matrizes[filename], filename);
+
+            // A cópia compartilha a estrutura; as alterações voltam ao registro ao final
+            Matriz matriz = matrizes.obter(filename);
+            manipMatrix(matriz, filename);
+            matrizes.definir(filename, matriz);
 
             break;
         }
 
         case IMPRIMIR_MATRIZ:
         {
-            if (matrizes.empty())
+            if (matrizes.empty() && pendentes.empty())
             {
                 std::cout << "Não há matrizes armazenadas" << std::endl;
                 break;
@@ -203,13 +288,13 @@ int main()
 
             // Imprime uma matriz armazenada
             std::cout << "Qual matriz deseja imprimir?" << std::endl;
-            printMatrizes(matrizes);
+            printMatrizes(matrizes, pendentes);
             std::cout << "Coloque o nome do arquivo que deseja imprimir: ";
             string filename;
             std::getline(std::cin, filename);
 
-            if (existeMatriz(filename, matrizes))
-                matrizes[filename].print();
+            if (aguardarMatriz(filename, matrizes, pendentes))
+                matrizes.obter(filename).print();
             else
                 std::cout << "Matriz não encontrada" << std::endl;
 
@@ -218,7 +303,7 @@ int main()
 
         case SOMAR_MATRIZES:
         {
-            if (matrizes.empty())
+            if (matrizes.empty() && pendentes.empty())
             {
                 std::cout << "Não há matrizes armazenadas" << std::endl;
                 break;
@@ -226,21 +311,23 @@ int main()
 
             // Soma duas matrizes armazenadas
             std::cout << "Quais as matrizes irá usar para somar" << std::endl;
-            printMatrizes(matrizes);
+            printMatrizes(matrizes, pendentes);
             std::string filename, filename2;
             escolherMatrizes(filename, filename2);
 
-            if (!existeMatriz(filename, matrizes) || !existeMatriz(filename2, matrizes))
+            // Operandos ainda em leitura são aguardados antes da operação
+            if (!aguardarMatriz(filename, matrizes, pendentes) || !aguardarMatriz(filename2, matrizes, pendentes))
             {
                 std::cout << "Alguma matriz não foi encontrada" << std::endl;
                 break;
             }
 
             Matriz matriz;
+            const size_t acertosAntes = resultados.getAcertos();
 
             try
             {
-                matriz = sum(matrizes[filename], matrizes[filename2]);
+                matriz = resultados.somar(matrizes.obter(filename), matrizes.obter(filename2));
             }
             catch (const std::exception &e)
             {
@@ -248,6 +335,9 @@ int main()
                 break;
             }
 
+            if (resultados.getAcertos() > acertosAntes)
+                std::cout << "(resultado reaproveitado do cache)" << std::endl;
+
             matriz.print();
             salvarMatriz(matriz, matrizes);
             break;
@@ -255,7 +345,7 @@ int main()
 
         case MULTIPLICAR_MATRIZES:
         {
-            if (matrizes.empty())
+            if (matrizes.empty() && pendentes.empty())
             {
                 std::cout << "Não há matrizes armazenadas" << std::endl;
                 break;
@@ -263,21 +353,23 @@ int main()
 
             // Multiplica duas matrizes armazenadas
             std::cout << "Quais as matrizes irá usar para multiplicar" << std::endl;
-            printMatrizes(matrizes);
+            printMatrizes(matrizes, pendentes);
             std::string filename, filename2;
             escolherMatrizes(filename, filename2);
 
-            if (!existeMatriz(filename, matrizes) || !existeMatriz(filename2, matrizes))
+            // Operandos ainda em leitura são aguardados antes da operação
+            if (!aguardarMatriz(filename, matrizes, pendentes) || !aguardarMatriz(filename2, matrizes, pendentes))
             {
                 std::cout << "Alguma matriz não foi encontrada" << std::endl;
                 break;
             }
 
             Matriz matriz;
+            const size_t acertosAntes = resultados.getAcertos();
 
             try
             {
-                matriz = multiply(matrizes[filename], matrizes[filename2]);
+                matriz = resultados.multiplicar(matrizes.obter(filename), matrizes.obter(filename2));
             }
             catch (const std::exception &e)
             {
@@ -285,6 +377,9 @@ int main()
                 break;
             }
 
+            if (resultados.getAcertos() > acertosAntes)
+                std::cout << "(resultado reaproveitado do cache)" << std::endl;
+
             matriz.print();
             salvarMatriz(matriz, matrizes);
             break;
@@ -313,35 +408,68 @@ int main()
     }
 }
 
-void readMatrix(Matriz &matriz, const std::string filename)
+void readMatrix(Matriz &matriz, const std::string filename, std::atomic<int> *progresso)
 {
-    std::ifstream file("src/arquivos/" + filename);
+    matriz = lerMatrizTexto("src/arquivos/" + filename, progresso);
+}
 
-    if (!file || !file.is_open())
-        throw std::runtime_error("Erro ao abrir o arquivo");
+void iniciarCarregamento(const string &filename, carregamentos &pendentes)
+{
+    auto progresso = std::make_shared<std::atomic<int>>(0);
 
-    int linhas{0}, colunas{0};
-    file >> linhas >> colunas;
+    std::future<Matriz> futuro = std::async(std::launch::async, [filename, progresso]()
+                                            {
+                                                Matriz matriz;
+                                                readMatrix(matriz, filename, progresso.get());
+                                                return matriz; });
 
-    matriz = Matriz(linhas, colunas);
+    pendentes.emplace(filename, Carregamento{std::move(futuro), progresso});
+}
 
-    int i{0}, j{0};
-    double valor{0.0f};
+void coletarCarregamentos(RegistroMatrizes &matrizes, carregamentos &pendentes)
+{
+    for (auto it = pendentes.begin(); it != pendentes.end();)
+    {
+        if (it->second.futuro.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ++it;
+            continue;
+        }
+
+        try
+        {
+            // Armazena a matriz no registro (a cópia apenas compartilha a estrutura encadeada)
+            matrizes.inserir(it->first, it->second.futuro.get());
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << it->first << ": " << e.what() << '\n';
+            std::cout << "Exemplo de arquivo: matrix.txt" << std::endl;
+        }
 
-    while (file >> i >> j >> valor)
+        it = pendentes.erase(it);
+    }
+}
+
+bool aguardarMatriz(const string &filename, RegistroMatrizes &matrizes, carregamentos &pendentes)
+{
+    auto it = pendentes.find(filename);
+    if (it != pendentes.end())
     {
-        matriz.insert(i, j, valor);
+        std::cout << "Aguardando o carregamento de " << filename << "..." << std::endl;
+        it->second.futuro.wait();
+        coletarCarregamentos(matrizes, pendentes);
     }
 
-    file.close();
+    return existeMatriz(filename, matrizes);
 }
 
-bool existeMatriz(const std::string filename, const unordered_map &matrizes)
+bool existeMatriz(const std::string filename, const RegistroMatrizes &matrizes)
 {
-    return matrizes.find(filename) != matrizes.end();
+    return matrizes.contem(filename);
 }
 
-void salvarMatriz(const Matriz &matriz, unordered_map &matrizes)
+void salvarMatriz(const Matriz &matriz, RegistroMatrizes &matrizes)
 {
     while (true)
     {
@@ -368,7 +496,7 @@ void salvarMatriz(const Matriz &matriz, unordered_map &matrizes)
                 break;
             }
 
-            matrizes.insert(std::make_pair(filename, matriz));
+            matrizes.inserir(filename, matriz);
 
             std::cout << "Matriz salva com sucesso" << std::endl;
             return;
@@ -390,12 +518,47 @@ void escolherMatrizes(string &filename, string &filename2)
     std::getline(std::cin, filename2);
 }
 
-void printMatrizes(const unordered_map &matrizes)
+void printMatrizes(const RegistroMatrizes &matrizes, const carregamentos &pendentes)
 {
-    for (const auto &par : matrizes)
+    for (const InfoRegistro &info : matrizes.listar())
+    {
+        std::cout << "------------------" << std::endl;
+        std::cout << info.nome << " |" << info.linhas << " x " << info.colunas << "|"
+                  << (info.emMemoria ? "" : " (em disco)") << std::endl;
+
+        // Resumo mantido pelo registro: nenhuma consulta percorre os nós nem recarrega a matriz
+        const double densidade = static_cast<double>(info.quantidade) / info.linhas / info.colunas;
+        std::ostringstream estatisticas;
+        estatisticas << std::setprecision(3) << info.quantidade << " não nulos, densidade "
+                     << 100 * densidade << "%, ~" << info.bytes / 1024.0 << " KiB";
+        std::cout << estatisticas.str() << std::endl;
+        std::cout << "------------------" << std::endl;
+    }
+
+    for (const auto &par : pendentes)
     {
         std::cout << "------------------" << std::endl;
-        std::cout << par.first << " |" << par.second.getLinhas() << " x " << par.second.getColunas() << "|" << std::endl;
+        std::cout << par.first << " |carregando (" << par.second.progresso->load() << "%)|" << std::endl;
         std::cout << "------------------" << std::endl;
     }
-}
\ No newline at end of file
+
+    if (matrizes.getOrcamento() != 0)
+    {
+        const EstatisticasRegistro &uso = matrizes.getEstatisticas();
+        std::cout << "Memória: ~" << uso.bytesEmMemoria / (1024 * 1024) << " de " << matrizes.getOrcamento() / (1024 * 1024)
+                  << " MiB | " << uso.acertos << " acertos, " << uso.faltas << " faltas, " << uso.despejos << " despejos"
+                  << std::endl;
+    }
+}
+
+size_t orcamentoRegistro()
+{
+    const char *valor = std::getenv("MATRIZ_ORCAMENTO_MB");
+    if (valor == nullptr)
+        return 0;
+
+    char *fim = nullptr;
+    const long long megabytes = std::strtoll(valor, &fim, 10);
+
+    return fim != valor && megabytes > 0 ? static_cast<size_t>(megabytes) * 1024 * 1024 : 0;
+}
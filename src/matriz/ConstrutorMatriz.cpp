@@ -0,0 +1,125 @@
+#include "matriz/ConstrutorMatriz.hpp"
+#include <algorithm>
+
+ConstrutorMatriz::ConstrutorMatriz(const int &lin, const int &col) : linhas(lin), colunas(col), ordenado(true)
+{
+    if (lin <= 0 || col <= 0)
+        throw std::invalid_argument("Erro: Tamanho de matriz inválido, insira valores maiores que 0");
+}
+
+void ConstrutorMatriz::reservar(const size_t &quantidade)
+{
+    entradas.reserve(quantidade);
+}
+
+void ConstrutorMatriz::adicionar(const int &posI, const int &posJ, const double &value)
+{
+    if (value == 0)
+        return;
+
+    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
+        throw std::invalid_argument("Erro: Local de inserção inválido");
+
+    if (ordenado && !entradas.empty())
+    {
+        const Tripla &ultima = entradas.back();
+        if (ultima.linha > posI || (ultima.linha == posI && ultima.coluna >= posJ))
+            ordenado = false;
+    }
+
+    entradas.push_back({posI, posJ, value});
+}
+
+void ConstrutorMatriz::adicionarSimetrico(const int &posI, const int &posJ, const double &value)
+{
+    adicionar(posI, posJ, value);
+
+    if (posI != posJ)
+        adicionar(posJ, posI, value);
+}
+
+size_t ConstrutorMatriz::quantidade() const
+{
+    return entradas.size();
+}
+
+int ConstrutorMatriz::getLinhas() const
+{
+    return linhas;
+}
+
+int ConstrutorMatriz::getColunas() const
+{
+    return colunas;
+}
+
+const std::vector<Tripla> &ConstrutorMatriz::getEntradas() const
+{
+    return entradas;
+}
+
+Matriz ConstrutorMatriz::construir(std::pmr::memory_resource *recurso)
+{
+    if (!ordenado)
+    {
+        // A ordenação estável preserva a ordem de chegada das posições repetidas
+        std::stable_sort(entradas.begin(), entradas.end(), [](const Tripla &a, const Tripla &b)
+                         { return a.linha < b.linha || (a.linha == b.linha && a.coluna < b.coluna); });
+    }
+
+    Matriz matriz(linhas, colunas, recurso);
+
+    // Último nó ligado em cada coluna; começa no próprio sentinela
+    std::vector<Node *> fimColuna(matriz.estrutura->sentinelasColuna);
+    std::vector<int> contagemLinha(linhas + 1, 0), contagemColuna(colunas + 1, 0);
+    Node *fimLinha = nullptr;
+    int linhaAtual = 0;
+
+    for (size_t k = 0; k < entradas.size(); k++)
+    {
+        const Tripla &entrada = entradas[k];
+
+        // Repetições: apenas a última ocorrência da posição é ligada
+        if (k + 1 < entradas.size() && entradas[k + 1].linha == entrada.linha && entradas[k + 1].coluna == entrada.coluna)
+            continue;
+
+        if (entrada.linha != linhaAtual)
+        {
+            linhaAtual = entrada.linha;
+            fimLinha = matriz.estrutura->sentinelasLinha[linhaAtual];
+        }
+
+        // A linha fica sempre fechada: se o recurso de memória falhar, a matriz parcial ainda pode ser destruída
+        Node *novo = matriz.estrutura->criarNo(entrada.linha, entrada.coluna, entrada.valor);
+        novo->direita = matriz.estrutura->sentinelasLinha[linhaAtual];
+
+        fimLinha->direita = novo;
+        fimLinha = novo;
+
+        fimColuna[entrada.coluna]->abaixo = novo;
+        fimColuna[entrada.coluna] = novo;
+
+        contagemLinha[entrada.linha]++;
+        contagemColuna[entrada.coluna]++;
+    }
+
+    // Fecha as listas circulares das colunas
+    for (int j = 1; j <= colunas; j++)
+        fimColuna[j]->abaixo = matriz.estrutura->sentinelasColuna[j];
+
+    // Contadores gravados uma vez no final, em vez de um incremento atômico por nó
+    size_t total = 0;
+    for (int i = 1; i <= linhas; i++)
+    {
+        matriz.estrutura->elementosLinha[i].store(contagemLinha[i], std::memory_order_relaxed);
+        total += contagemLinha[i];
+    }
+    for (int j = 1; j <= colunas; j++)
+        matriz.estrutura->elementosColuna[j].store(contagemColuna[j], std::memory_order_relaxed);
+    matriz.estrutura->elementos.store(total, std::memory_order_relaxed);
+
+    entradas.clear();
+    ordenado = true;
+
+    return matriz;
+}
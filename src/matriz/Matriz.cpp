@@ -1,90 +1,166 @@
 #include "matriz/Matriz.hpp"
+#include "matriz/VisaoMatriz.hpp"
+#include "matriz/Poda.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 
-Matriz::Matriz() : cabecalho(new Node(0, 0, 0)), linhas(0), colunas(0)
+/**
+ * @brief Travas do modo concorrente: uma por faixa de linhas e uma por faixa de colunas.
+ */
+struct TravasConcorrentes
 {
-    cabecalho->direita = cabecalho->abaixo = cabecalho;
-}
+    std::vector<std::mutex> linhas;  /**< Travas das faixas de linhas. */
+    std::vector<std::mutex> colunas; /**< Travas das faixas de colunas. */
 
-Matriz::Matriz(const int &lin, const int &col)
+    explicit TravasConcorrentes(const size_t &faixas) : linhas(faixas), colunas(faixas) {}
+};
+
+namespace
 {
-    if (lin <= 0 || col <= 0)
-        throw std::invalid_argument("Erro: Tamanho de matriz inválido, insira valores maiores que 0");
+    /**
+     * @brief Adquire todas as travas do modo concorrente, linhas antes de colunas, em ordem crescente.
+     *
+     * É a mesma ordem usada por insert()/erase(), o que evita impasses com escritores pontuais.
+     */
+    std::vector<std::unique_lock<std::mutex>> travarTodas(TravasConcorrentes *travas)
+    {
+        std::vector<std::unique_lock<std::mutex>> adquiridas;
 
-    linhas = lin;
-    colunas = col;
+        if (travas == nullptr)
+            return adquiridas;
 
-    cabecalho = new Node(0, 0, 0);
-    cabecalho->direita = cabecalho->abaixo = cabecalho;
+        adquiridas.reserve(travas->linhas.size() + travas->colunas.size());
+        for (std::mutex &trava : travas->linhas)
+            adquiridas.emplace_back(trava);
+        for (std::mutex &trava : travas->colunas)
+            adquiridas.emplace_back(trava);
+
+        return adquiridas;
+    }
 
-    Node *auxLinha = cabecalho;
-    for (int i = 1; i <= lin; i++)
+    /**
+     * @brief Liga \p novo na coluna, a partir do último nó conhecido acima dele.
+     *
+     * @param acima Nó da coluna com linha menor que a de \p novo (ou o sentinela); é atualizado para \p novo.
+     */
+    void ligarNaColuna(Node *novo, Node *&acima)
     {
-        Node *novo = new Node(i, 0, 0);
-        auxLinha->abaixo = novo;
-        novo->direita = novo;
-        auxLinha = novo;
+        while (acima->abaixo->linha != 0 && acima->abaixo->linha < novo->linha)
+            acima = acima->abaixo;
+
+        novo->abaixo = acima->abaixo;
+        acima->abaixo = novo;
+        acima = novo;
     }
-    auxLinha->abaixo = cabecalho;
 
-    Node *auxColuna = cabecalho;
-    for (int j = 1; j <= col; j++)
+    /**
+     * @brief Desliga \p alvo da coluna, a partir do último nó conhecido acima dele.
+     *
+     * @param acima Nó da coluna com linha menor que a de \p alvo (ou o sentinela); passa a ser o antecessor de \p alvo.
+     */
+    void desligarDaColuna(Node *alvo, Node *&acima)
     {
-        Node *novo = new Node(0, j, 0);
-        auxColuna->direita = novo;
-        novo->abaixo = novo;
-        auxColuna = novo;
+        while (acima->abaixo != alvo)
+            acima = acima->abaixo;
+
+        acima->abaixo = alvo->abaixo;
     }
-    auxColuna->direita = cabecalho;
-}
 
-Matriz::Matriz(const Matriz &outra) : Matriz(outra.linhas, outra.colunas)
-{
-    for (IteratorM it = outra.begin(); it != outra.end(); ++it)
-        this->insert(it.current->linha, it.current->coluna, *it);
-}
+    /**
+     * @brief Valida uma permutação de 1..n e retorna sua inversa (posição 0 sem uso).
+     *
+     * Uma permutação vazia é tratada como a identidade.
+     */
+    std::vector<int> inverterPermutacao(const std::vector<int> &permutacao, const int &n)
+    {
+        std::vector<int> inversa(n + 1, 0);
 
-IteratorM Matriz::begin()
-{
-    return IteratorM(cabecalho->abaixo, cabecalho->abaixo->direita);
-}
+        if (permutacao.empty())
+        {
+            for (int k = 1; k <= n; k++)
+                inversa[k] = k;
 
-IteratorM Matriz::end()
-{
-    return IteratorM(cabecalho, cabecalho->direita);
-}
+            return inversa;
+        }
 
-IteratorM Matriz::begin() const
-{
-    return IteratorM(cabecalho->abaixo, cabecalho->abaixo->direita);
-}
+        if (permutacao.size() != static_cast<size_t>(n))
+            throw std::invalid_argument("Erro: A permutação precisa ter um índice para cada linha ou coluna");
 
-IteratorM Matriz::end() const
-{
-    return IteratorM(cabecalho, cabecalho->direita);
-}
+        for (int k = 1; k <= n; k++)
+        {
+            const int original = permutacao[k - 1];
 
-Matriz Matriz::operator=(Matriz matriz)
-{
-    // Troca os dados do objeto atual com os dados de 'matriz'
-    std::swap(cabecalho, matriz.cabecalho);
-    std::swap(linhas, matriz.linhas);
-    std::swap(colunas, matriz.colunas);
-    // 'matriz' é destruída, liberando os recursos antigos
-    return *this;
-}
+            if (original <= 0 || original > n || inversa[original] != 0)
+                throw std::invalid_argument("Erro: Permutação inválida");
 
-int Matriz::getLinhas() const
-{
-    return linhas;
+            inversa[original] = k;
+        }
+
+        return inversa;
+    }
+
+    /**
+     * @brief Retorna um número ainda não usado por nenhuma estrutura deste processo.
+     */
+    uint64_t novaIdentidade()
+    {
+        static std::atomic<uint64_t> proxima{1};
+        return proxima.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
-int Matriz::getColunas() const
+EstruturaMatriz::EstruturaMatriz(const int &lin, const int &col, std::pmr::memory_resource *recurso)
+    : recurso(recurso), cabecalho(criarNo(0, 0, 0)), linhas(lin), colunas(col), identidade(novaIdentidade()),
+      elementosLinha(lin + 1), elementosColuna(col + 1)
 {
-    return colunas;
+    cabecalho->direita = cabecalho->abaixo = cabecalho;
+
+    try
+    {
+        sentinelasLinha.reserve(lin + 1);
+        sentinelasLinha.push_back(cabecalho);
+        sentinelasColuna.reserve(col + 1);
+        sentinelasColuna.push_back(cabecalho);
+
+        Node *auxLinha = cabecalho;
+        for (int i = 1; i <= lin; i++)
+        {
+            Node *novo = criarNo(i, 0, 0);
+            auxLinha->abaixo = novo;
+            novo->direita = novo;
+            auxLinha = novo;
+            sentinelasLinha.push_back(novo);
+        }
+        auxLinha->abaixo = cabecalho;
+
+        Node *auxColuna = cabecalho;
+        for (int j = 1; j <= col; j++)
+        {
+            Node *novo = criarNo(0, j, 0);
+            auxColuna->direita = novo;
+            novo->abaixo = novo;
+            auxColuna = novo;
+            sentinelasColuna.push_back(novo);
+        }
+        auxColuna->direita = cabecalho;
+    }
+    catch (...)
+    {
+        // O destrutor não é chamado se o construtor falhar (por exemplo, com o limite de um RecursoMonitorado)
+        for (size_t i = 1; i < sentinelasLinha.size(); i++)
+            liberarNo(sentinelasLinha[i]);
+        for (size_t j = 1; j < sentinelasColuna.size(); j++)
+            liberarNo(sentinelasColuna[j]);
+        liberarNo(cabecalho);
+        throw;
+    }
 }
 
-Matriz::~Matriz()
+EstruturaMatriz::~EstruturaMatriz()
 {
     if (cabecalho == nullptr)
         return;
@@ -95,7 +171,7 @@ Matriz::~Matriz()
     while (linhaAtual != cabecalho)
     {
         Node *proximoLinha = linhaAtual->abaixo;
-        delete linhaAtual;
+        liberarNo(linhaAtual);
         linhaAtual = proximoLinha;
     }
 
@@ -103,19 +179,25 @@ Matriz::~Matriz()
     while (colunaAtual != cabecalho)
     {
         Node *proximoColuna = colunaAtual->direita;
-        delete colunaAtual;
+        liberarNo(colunaAtual);
         colunaAtual = proximoColuna;
     }
 
-    delete cabecalho;
+    liberarNo(cabecalho);
     cabecalho = nullptr;
 }
 
-void Matriz::limpar()
+void EstruturaMatriz::limpar()
 {
     if (cabecalho == nullptr)
         return;
 
+    elementos = 0;
+    for (std::atomic<int> &contador : elementosLinha)
+        contador = 0;
+    for (std::atomic<int> &contador : elementosColuna)
+        contador = 0;
+
     Node *LinhaAtual = cabecalho->abaixo;
     if (LinhaAtual == cabecalho)
         return;
@@ -135,7 +217,7 @@ void Matriz::limpar()
         while (atual != linha)
         {
             Node *proximo = atual->direita;
-            delete atual;
+            liberarNo(atual);
             atual = proximo;
         }
         linha->direita = linha;
@@ -147,6 +229,235 @@ void Matriz::limpar()
         ColunaAtual = ColunaAtual->abaixo;
     }
     ColunaAtual->abaixo = cabecalho;
+
+    // Os nós de dados das colunas já foram desalocados pelas linhas
+    for (size_t j = 1; j < sentinelasColuna.size(); j++)
+        sentinelasColuna[j]->abaixo = sentinelasColuna[j];
+}
+
+Matriz::Matriz() : estrutura(std::make_shared<EstruturaMatriz>(0, 0, std::pmr::get_default_resource()))
+{
+}
+
+Matriz::Matriz(const int &lin, const int &col, std::pmr::memory_resource *recurso)
+{
+    if (lin <= 0 || col <= 0)
+        throw std::invalid_argument("Erro: Tamanho de matriz inválido, insira valores maiores que 0");
+
+    if (recurso == nullptr)
+        throw std::invalid_argument("Erro: Recurso de memória nulo");
+
+    estrutura = std::make_shared<EstruturaMatriz>(lin, col, recurso);
+}
+
+Matriz::Matriz(const Matriz &outra) : estrutura(outra.estrutura)
+{
+    if (outra.travas)
+        separar();
+}
+
+void Matriz::separar()
+{
+    if (estrutura.use_count() <= 1)
+        return;
+
+    auto copia = std::make_shared<EstruturaMatriz>(estrutura->linhas, estrutura->colunas, estrutura->recurso);
+
+    // Último nó ligado em cada coluna da cópia; começa no próprio sentinela
+    std::vector<Node *> fimColuna(copia->sentinelasColuna);
+
+    for (int i = 1; i <= estrutura->linhas; i++)
+    {
+        const Node *origem = estrutura->sentinelasLinha[i];
+        Node *fimLinha = copia->sentinelasLinha[i];
+
+        for (const Node *aux = origem->direita; aux != origem; aux = aux->direita)
+        {
+            // A linha fica sempre fechada: se o recurso de memória falhar, a cópia ainda pode ser destruída
+            Node *novo = copia->criarNo(aux->linha, aux->coluna, aux->valor);
+            novo->direita = copia->sentinelasLinha[i];
+
+            fimLinha->direita = novo;
+            fimLinha = novo;
+
+            fimColuna[aux->coluna]->abaixo = novo;
+            fimColuna[aux->coluna] = novo;
+        }
+    }
+
+    for (int j = 1; j <= estrutura->colunas; j++)
+        fimColuna[j]->abaixo = copia->sentinelasColuna[j];
+
+    copia->elementos = estrutura->elementos.load();
+    for (int i = 1; i <= estrutura->linhas; i++)
+        copia->elementosLinha[i] = estrutura->elementosLinha[i].load();
+    for (int j = 1; j <= estrutura->colunas; j++)
+        copia->elementosColuna[j] = estrutura->elementosColuna[j].load();
+
+    estrutura = std::move(copia);
+}
+
+void Matriz::alterar()
+{
+    // Uma estrutura recém-separada já tem identidade própria; avançar a versão também é inofensivo
+    separar();
+    estrutura->versao.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool Matriz::compartilhada() const
+{
+    return estrutura.use_count() > 1;
+}
+
+IteratorM Matriz::begin()
+{
+    // Só as escritas pelo iterador avançam a versão
+    separar();
+    Node *cabecalho = estrutura->cabecalho;
+    return IteratorM(cabecalho->abaixo, cabecalho->abaixo->direita, &estrutura->versao);
+}
+
+IteratorM Matriz::end()
+{
+    separar();
+    Node *cabecalho = estrutura->cabecalho;
+    return IteratorM(cabecalho, cabecalho->direita, &estrutura->versao);
+}
+
+ConstIteratorM Matriz::begin() const
+{
+    const Node *cabecalho = estrutura->cabecalho;
+    return ConstIteratorM(cabecalho->abaixo, cabecalho->abaixo->direita);
+}
+
+ConstIteratorM Matriz::end() const
+{
+    const Node *cabecalho = estrutura->cabecalho;
+    return ConstIteratorM(cabecalho, cabecalho->direita);
+}
+
+Matriz &Matriz::operator=(Matriz matriz)
+{
+    // Troca apenas a estrutura: as travas continuam com este objeto, que segue no modo concorrente
+    std::swap(estrutura, matriz.estrutura);
+
+    // Escritores concorrentes não podem disputar a separação de uma estrutura compartilhada
+    if (travas)
+        separar();
+
+    // 'matriz' é destruída, liberando os recursos antigos
+    return *this;
+}
+
+int Matriz::getLinhas() const
+{
+    return estrutura->linhas;
+}
+
+int Matriz::getColunas() const
+{
+    return estrutura->colunas;
+}
+
+const Node *Matriz::getSentinelaLinha(const int &posI) const
+{
+    if (posI <= 0 || posI > estrutura->linhas)
+        throw std::invalid_argument("Erro: Linha inválida");
+
+    return estrutura->sentinelasLinha[posI];
+}
+
+const Node *Matriz::getSentinelaColuna(const int &posJ) const
+{
+    if (posJ <= 0 || posJ > estrutura->colunas)
+        throw std::invalid_argument("Erro: Coluna inválida");
+
+    return estrutura->sentinelasColuna[posJ];
+}
+
+void Matriz::habilitarConcorrencia(const size_t &faixas)
+{
+    if (faixas == 0)
+        throw std::invalid_argument("Erro: Quantidade de travas inválida, insira um valor maior que 0");
+
+    // Escritores concorrentes não podem disputar a separação de uma estrutura compartilhada
+    separar();
+    travas = std::make_unique<TravasConcorrentes>(faixas);
+}
+
+void Matriz::desabilitarConcorrencia()
+{
+    travas.reset();
+}
+
+bool Matriz::concorrente() const
+{
+    return travas != nullptr;
+}
+
+bool Matriz::verificarIntegridade() const
+{
+    const int linhas = estrutura->linhas, colunas = estrutura->colunas;
+    const std::vector<Node *> &sentinelasLinha = estrutura->sentinelasLinha;
+    const std::vector<Node *> &sentinelasColuna = estrutura->sentinelasColuna;
+    size_t nosLinhas = 0, nosColunas = 0;
+
+    for (int i = 1; i <= linhas; i++)
+    {
+        const Node *sentinela = sentinelasLinha[i];
+        int colunaAnterior = 0, nosLinha = 0;
+
+        for (const Node *aux = sentinela->direita; aux != sentinela; aux = aux->direita)
+        {
+            if (aux->linha != i || aux->coluna <= colunaAnterior || aux->coluna > colunas)
+                return false;
+
+            colunaAnterior = aux->coluna;
+            nosLinhas++;
+            nosLinha++;
+        }
+
+        if (nosLinha != estrutura->elementosLinha[i].load())
+            return false;
+    }
+
+    for (int j = 1; j <= colunas; j++)
+    {
+        const Node *sentinela = sentinelasColuna[j];
+        int linhaAnterior = 0, nosColuna = 0;
+
+        for (const Node *aux = sentinela->abaixo; aux != sentinela; aux = aux->abaixo)
+        {
+            if (aux->coluna != j || aux->linha <= linhaAnterior || aux->linha > linhas)
+                return false;
+
+            linhaAnterior = aux->linha;
+            nosColunas++;
+            nosColuna++;
+        }
+
+        if (nosColuna != estrutura->elementosColuna[j].load())
+            return false;
+    }
+
+    return nosLinhas == nosColunas && nosLinhas == quantidade();
+}
+
+Matriz::~Matriz()
+{
+}
+
+void Matriz::limpar()
+{
+    if (estrutura.use_count() > 1)
+    {
+        // Não há por que copiar nós que seriam removidos em seguida
+        estrutura = std::make_shared<EstruturaMatriz>(estrutura->linhas, estrutura->colunas, estrutura->recurso);
+        return;
+    }
+
+    estrutura->versao.fetch_add(1, std::memory_order_relaxed);
+    estrutura->limpar();
 }
 
 void Matriz::insert(const int &posI, const int &posJ, const double &value)
@@ -154,15 +465,21 @@ void Matriz::insert(const int &posI, const int &posJ, const double &value)
     if (value == 0)
         return;
 
-    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
+    if (posI <= 0 || posI > getLinhas() || posJ <= 0 || posJ > getColunas())
         throw std::invalid_argument("Erro: Local de inserção inválido");
 
-    Node *linhaAtual = cabecalho;
-    while (linhaAtual->linha < posI)
+    alterar();
+
+    // Modo concorrente: sempre a trava da linha antes da trava da coluna
+    std::unique_lock<std::mutex> travaLinha, travaColuna;
+    if (travas)
     {
-        linhaAtual = linhaAtual->abaixo;
+        travaLinha = std::unique_lock<std::mutex>(travas->linhas[posI % travas->linhas.size()]);
+        travaColuna = std::unique_lock<std::mutex>(travas->colunas[posJ % travas->colunas.size()]);
     }
 
+    Node *linhaAtual = estrutura->sentinelasLinha[posI];
+
     Node *aux = linhaAtual;
     while (aux->direita != linhaAtual && aux->direita->coluna < posJ)
     {
@@ -175,16 +492,12 @@ void Matriz::insert(const int &posI, const int &posJ, const double &value)
         return;
     }
 
-    Node *novo = new Node(posI, posJ, value);
+    Node *novo = estrutura->criarNo(posI, posJ, value);
 
     novo->direita = aux->direita;
     aux->direita = novo;
 
-    Node *colunaAtual = cabecalho;
-    while (colunaAtual->coluna < posJ)
-    {
-        colunaAtual = colunaAtual->direita;
-    }
+    Node *colunaAtual = estrutura->sentinelasColuna[posJ];
 
     aux = colunaAtual;
     while (aux->abaixo != colunaAtual && aux->abaixo->linha < posI)
@@ -194,61 +507,896 @@ void Matriz::insert(const int &posI, const int &posJ, const double &value)
 
     novo->abaixo = aux->abaixo;
     aux->abaixo = novo;
+    estrutura->registrarNo(posI, posJ);
 }
 
-double Matriz::get(const int &posI, const int &posJ)
+bool Matriz::erase(const int &posI, const int &posJ)
 {
-    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
-        throw std::invalid_argument("Erro: Local de acesso inválido");
+    if (posI <= 0 || posI > getLinhas() || posJ <= 0 || posJ > getColunas())
+        throw std::invalid_argument("Erro: Local de remoção inválido");
+
+    // Estrutura compartilhada: só vale separá-la (cópia O(nnz)) se a posição estiver ocupada
+    if (compartilhada())
+    {
+        const Node *sentinela = estrutura->sentinelasLinha[posI];
+        const Node *no = sentinela->direita;
+        while (no != sentinela && no->coluna < posJ)
+            no = no->direita;
+
+        if (no == sentinela || no->coluna != posJ)
+            return false;
+    }
 
-    IteratorM it = begin();
+    separar();
 
-    // Avança enquanto o nó atual estiver "antes" da posição desejada.
-    while (it != end() &&
-           (it.current->linha < posI ||
-            (it.current->linha == posI && it.current->coluna < posJ)))
+    std::unique_lock<std::mutex> travaLinha, travaColuna;
+    if (travas)
     {
-        ++it;
+        travaLinha = std::unique_lock<std::mutex>(travas->linhas[posI % travas->linhas.size()]);
+        travaColuna = std::unique_lock<std::mutex>(travas->colunas[posJ % travas->colunas.size()]);
     }
 
-    // Se o nó atual corresponde exatamente à posição, retorna o valor.
-    if (it != end() && it.current->linha == posI && it.current->coluna == posJ)
-        return *it;
+    Node *linhaAtual = estrutura->sentinelasLinha[posI];
+    Node *aux = linhaAtual;
+    while (aux->direita != linhaAtual && aux->direita->coluna < posJ)
+    {
+        aux = aux->direita;
+    }
 
-    return 0;
+    if (aux->direita == linhaAtual || aux->direita->coluna != posJ)
+        return false;
+
+    Node *alvo = aux->direita;
+    aux->direita = alvo->direita;
+
+    Node *colunaAtual = estrutura->sentinelasColuna[posJ];
+    aux = colunaAtual;
+    while (aux->abaixo != alvo)
+    {
+        aux = aux->abaixo;
+    }
+    aux->abaixo = alvo->abaixo;
+
+    estrutura->descontarNo(posI, posJ);
+    estrutura->liberarNo(alvo);
+    estrutura->versao.fetch_add(1, std::memory_order_relaxed);
+    return true;
 }
 
-double Matriz::get(const int &posI, const int &posJ) const
+Matriz &Matriz::adicionarEscalado(const double &alfa, const Matriz &matrizB)
 {
-    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
-        throw std::invalid_argument("Erro: Local de acesso inválido");
+    if (getLinhas() != matrizB.getLinhas() || getColunas() != matrizB.getColunas())
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho");
+
+    // A += alfa * A: a cópia compartilha a estrutura, e separar() dá a esta matriz nós próprios
+    if (&matrizB == this)
+        return adicionarEscalado(alfa, Matriz(matrizB));
 
-    IteratorM it = begin();
+    if (alfa == 0)
+        return *this;
 
-    // Avança enquanto o nó atual estiver "antes" da posição desejada.
-    while (it != end() &&
-           (it.current->linha < posI ||
-            (it.current->linha == posI && it.current->coluna < posJ)))
+    alterar();
+    auto adquiridas = travarTodas(travas.get());
+
+    // Último nó visitado em cada coluna; as linhas são tratadas em ordem crescente
+    std::vector<Node *> acima(estrutura->sentinelasColuna);
+
+    for (int i = 1; i <= getLinhas(); i++)
     {
-        ++it;
+        const Node *sentinelaB = matrizB.estrutura->sentinelasLinha[i];
+        if (sentinelaB->direita == sentinelaB)
+            continue;
+
+        Node *sentinela = estrutura->sentinelasLinha[i];
+        Node *anterior = sentinela;
+
+        for (const Node *b = sentinelaB->direita; b != sentinelaB; b = b->direita)
+        {
+            while (anterior->direita != sentinela && anterior->direita->coluna < b->coluna)
+                anterior = anterior->direita;
+
+            Node *atual = anterior->direita;
+
+            if (atual != sentinela && atual->coluna == b->coluna)
+            {
+                atual->valor += alfa * b->valor;
+
+                if (atual->valor == 0)
+                {
+                    anterior->direita = atual->direita;
+                    desligarDaColuna(atual, acima[b->coluna]);
+                    estrutura->descontarNo(i, b->coluna);
+                    estrutura->liberarNo(atual);
+                }
+            }
+            else
+            {
+                const double valor = alfa * b->valor;
+                if (valor == 0)
+                    continue;
+
+                Node *novo = estrutura->criarNo(i, b->coluna, valor);
+                novo->direita = atual;
+                anterior->direita = novo;
+                anterior = novo;
+                ligarNaColuna(novo, acima[b->coluna]);
+                estrutura->registrarNo(i, b->coluna);
+            }
+        }
     }
 
-    // Se o nó atual corresponde exatamente à posição, retorna o valor.
-    if (it != end() && it.current->linha == posI && it.current->coluna == posJ)
-        return *it;
+    return *this;
+}
 
-    return 0;
+Matriz &Matriz::operator+=(const Matriz &matrizB)
+{
+    return adicionarEscalado(1.0, matrizB);
 }
 
-void Matriz::print()
+Matriz &Matriz::operator-=(const Matriz &matrizB)
 {
-    IteratorM it = begin();
+    return adicionarEscalado(-1.0, matrizB);
+}
 
-    for (int i = 1; i <= linhas; i++)
+Matriz &Matriz::operator*=(const double &alfa)
+{
+    if (alfa == 0)
+    {
+        limpar();
+        return *this;
+    }
+
+    alterar();
+    auto adquiridas = travarTodas(travas.get());
+
+    // Preenchido apenas se algum elemento precisar ser removido
+    std::vector<Node *> acima;
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        Node *sentinela = estrutura->sentinelasLinha[i];
+        Node *anterior = sentinela;
+
+        while (anterior->direita != sentinela)
+        {
+            Node *atual = anterior->direita;
+            atual->valor *= alfa;
+
+            // Apenas subfluxo (valores muito pequenos) pode zerar um elemento
+            if (atual->valor == 0)
+            {
+                if (acima.empty())
+                    acima = estrutura->sentinelasColuna;
+
+                anterior->direita = atual->direita;
+                desligarDaColuna(atual, acima[atual->coluna]);
+                estrutura->descontarNo(i, atual->coluna);
+                estrutura->liberarNo(atual);
+                continue;
+            }
+
+            anterior = atual;
+        }
+    }
+
+    return *this;
+}
+
+Matriz &Matriz::hadamard(const Matriz &matrizB)
+{
+    if (getLinhas() != matrizB.getLinhas() || getColunas() != matrizB.getColunas())
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho");
+
+    if (&matrizB == this)
+        return hadamard(Matriz(matrizB));
+
+    alterar();
+    auto adquiridas = travarTodas(travas.get());
+
+    std::vector<Node *> acima(estrutura->sentinelasColuna);
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        Node *sentinela = estrutura->sentinelasLinha[i];
+        const Node *sentinelaB = matrizB.estrutura->sentinelasLinha[i];
+        const Node *b = sentinelaB->direita;
+        Node *anterior = sentinela;
+
+        while (anterior->direita != sentinela)
+        {
+            Node *atual = anterior->direita;
+
+            while (b != sentinelaB && b->coluna < atual->coluna)
+                b = b->direita;
+
+            if (b != sentinelaB && b->coluna == atual->coluna)
+                atual->valor *= b->valor;
+            else
+                atual->valor = 0;
+
+            if (atual->valor == 0)
+            {
+                anterior->direita = atual->direita;
+                desligarDaColuna(atual, acima[atual->coluna]);
+                estrutura->descontarNo(i, atual->coluna);
+                estrutura->liberarNo(atual);
+                continue;
+            }
+
+            anterior = atual;
+        }
+    }
+
+    return *this;
+}
+
+size_t Matriz::prune(const double &tolerancia, const size_t &maximoPorLinha)
+{
+    if (tolerancia < 0)
+        throw std::invalid_argument("Erro: Tolerância negativa");
+
+    const OpcoesPoda opcoes{tolerancia, maximoPorLinha};
+    std::vector<double> valores;
+
+    auto carregarLinha = [&](const Node *sentinela)
+    {
+        valores.clear();
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+            valores.push_back(no->valor);
+    };
+
+    // Estrutura compartilhada: só vale separá-la (cópia O(nnz)) se algum elemento for de fato removido
+    if (compartilhada())
+    {
+        bool remover = false;
+        for (int i = 1; i <= getLinhas() && !remover; i++)
+        {
+            const Node *sentinela = estrutura->sentinelasLinha[i];
+            carregarLinha(sentinela);
+
+            PodaLinha poda(opcoes, valores);
+            for (const Node *no = sentinela->direita; no != sentinela && !remover; no = no->direita)
+                remover = !poda.manter(no->valor);
+        }
+
+        if (!remover)
+            return 0;
+    }
+
+    alterar();
+    auto adquiridas = travarTodas(travas.get());
+
+    std::vector<Node *> acima(estrutura->sentinelasColuna);
+    size_t removidos = 0;
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        Node *sentinela = estrutura->sentinelasLinha[i];
+        carregarLinha(sentinela);
+
+        PodaLinha poda(opcoes, valores);
+        Node *anterior = sentinela;
+
+        while (anterior->direita != sentinela)
+        {
+            Node *atual = anterior->direita;
+
+            if (poda.manter(atual->valor))
+            {
+                anterior = atual;
+                continue;
+            }
+
+            anterior->direita = atual->direita;
+            desligarDaColuna(atual, acima[atual->coluna]);
+            estrutura->descontarNo(i, atual->coluna);
+            estrutura->liberarNo(atual);
+            removidos++;
+        }
+    }
+
+    return removidos;
+}
+
+std::optional<DiferencaMatriz> Matriz::primeiraDiferenca(const Matriz &outra, const double &rtol, const double &atol) const
+{
+    if (getLinhas() != outra.getLinhas() || getColunas() != outra.getColunas())
+        return DiferencaMatriz{};
+
+    if (estrutura == outra.estrutura)
+        return std::nullopt;
+
+    auto iguais = [&](const double &a, const double &b)
+    {
+        return a == b || std::fabs(a - b) <= atol + rtol * std::max(std::fabs(a), std::fabs(b));
+    };
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        const Node *sentinelaA = estrutura->sentinelasLinha[i];
+        const Node *sentinelaB = outra.estrutura->sentinelasLinha[i];
+        const Node *a = sentinelaA->direita, *b = sentinelaB->direita;
+
+        while (a != sentinelaA || b != sentinelaB)
+        {
+            DiferencaMatriz atual{i, 0, 0.0, 0.0};
+
+            if (b == sentinelaB || (a != sentinelaA && a->coluna < b->coluna))
+            {
+                atual.coluna = a->coluna;
+                atual.valorA = a->valor;
+                a = a->direita;
+            }
+            else if (a == sentinelaA || b->coluna < a->coluna)
+            {
+                atual.coluna = b->coluna;
+                atual.valorB = b->valor;
+                b = b->direita;
+            }
+            else
+            {
+                atual.coluna = a->coluna;
+                atual.valorA = a->valor;
+                atual.valorB = b->valor;
+                a = a->direita;
+                b = b->direita;
+            }
+
+            if (!iguais(atual.valorA, atual.valorB))
+                return atual;
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool Matriz::operator==(const Matriz &outra) const
+{
+    return !primeiraDiferenca(outra);
+}
+
+bool Matriz::approxEqual(const Matriz &outra, const double &rtol, const double &atol, DiferencaMatriz *diferenca) const
+{
+    std::optional<DiferencaMatriz> encontrada = primeiraDiferenca(outra, rtol, atol);
+
+    if (encontrada && diferenca != nullptr)
+        *diferenca = *encontrada;
+
+    return !encontrada;
+}
+
+size_t Matriz::quantidade() const
+{
+    return estrutura->elementos.load(std::memory_order_relaxed);
+}
+
+int Matriz::quantidadeLinha(const int &posI) const
+{
+    if (posI <= 0 || posI > getLinhas())
+        throw std::invalid_argument("Erro: Linha inválida");
+
+    return estrutura->elementosLinha[posI].load(std::memory_order_relaxed);
+}
+
+int Matriz::quantidadeColuna(const int &posJ) const
+{
+    if (posJ <= 0 || posJ > getColunas())
+        throw std::invalid_argument("Erro: Coluna inválida");
+
+    return estrutura->elementosColuna[posJ].load(std::memory_order_relaxed);
+}
+
+double Matriz::densidade() const
+{
+    if (getLinhas() == 0 || getColunas() == 0)
+        return 0.0;
+
+    return static_cast<double>(quantidade()) / (static_cast<double>(getLinhas()) * getColunas());
+}
+
+size_t Matriz::memoryUsage() const
+{
+    const size_t nos = quantidade() + getLinhas() + getColunas() + 1; // Dados, sentinelas e cabeçalho
+
+    return sizeof(Matriz) + sizeof(EstruturaMatriz) + nos * sizeof(Node) +
+           (estrutura->sentinelasLinha.capacity() + estrutura->sentinelasColuna.capacity()) * sizeof(Node *) +
+           (estrutura->elementosLinha.size() + estrutura->elementosColuna.size()) * sizeof(std::atomic<int>) +
+           (travas ? travas->linhas.size() + travas->colunas.size() : 0) * sizeof(std::mutex);
+}
+
+std::pmr::memory_resource *Matriz::getRecurso() const
+{
+    return estrutura->recurso;
+}
+
+uint64_t Matriz::getIdentidade() const
+{
+    return estrutura->identidade;
+}
+
+uint64_t Matriz::getVersao() const
+{
+    return estrutura->versao.load(std::memory_order_relaxed);
+}
+
+Matriz Matriz::applyPermutation(const std::vector<int> &permLinhas, const std::vector<int> &permColunas) const
+{
+    const std::vector<int> inversaLinhas = inverterPermutacao(permLinhas, getLinhas());
+    inverterPermutacao(permColunas, getColunas());
+
+    Matriz resultado(getLinhas(), getColunas(), estrutura->recurso);
+    EstruturaMatriz &destino = *resultado.estrutura;
+
+    // Colunas na nova ordem: cada nova linha recebe seus elementos com as colunas já em ordem crescente
+    std::vector<Node *> fimLinha(destino.sentinelasLinha);
+
+    for (int j = 1; j <= getColunas(); j++)
+    {
+        const Node *sentinela = estrutura->sentinelasColuna[permColunas.empty() ? j : permColunas[j - 1]];
+        for (const Node *no = sentinela->abaixo; no != sentinela; no = no->abaixo)
+        {
+            const int i = inversaLinhas[no->linha];
+            Node *novo = destino.criarNo(i, j, no->valor);
+            novo->direita = destino.sentinelasLinha[i]; // Linha sempre fechada, como em separar()
+
+            fimLinha[i]->direita = novo;
+            fimLinha[i] = novo;
+        }
+    }
+
+    // Novas linhas em ordem: as colunas são ligadas com as linhas em ordem crescente
+    std::vector<Node *> fimColuna(destino.sentinelasColuna);
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        Node *sentinela = destino.sentinelasLinha[i];
+        for (Node *no = sentinela->direita; no != sentinela; no = no->direita)
+        {
+            fimColuna[no->coluna]->abaixo = no;
+            fimColuna[no->coluna] = no;
+        }
+    }
+
+    for (int j = 1; j <= getColunas(); j++)
+        fimColuna[j]->abaixo = destino.sentinelasColuna[j];
+
+    // Os contadores são apenas permutados
+    destino.elementos = quantidade();
+    for (int i = 1; i <= getLinhas(); i++)
+        destino.elementosLinha[i] = estrutura->elementosLinha[permLinhas.empty() ? i : permLinhas[i - 1]].load();
+    for (int j = 1; j <= getColunas(); j++)
+        destino.elementosColuna[j] = estrutura->elementosColuna[permColunas.empty() ? j : permColunas[j - 1]].load();
+
+    return resultado;
+}
+
+ReordenacaoRCM Matriz::reorderRCM() const
+{
+    if (getLinhas() != getColunas())
+        throw std::invalid_argument("Erro: A reordenação exige uma matriz quadrada");
+
+    const int n = getLinhas();
+
+    // Vizinhos de v na estrutura simetrizada: intercala a linha v (colunas) com a coluna v (linhas)
+    auto vizinhos = [this](const int &v, auto visitar)
+    {
+        const Node *sentinelaLinha = estrutura->sentinelasLinha[v];
+        const Node *sentinelaColuna = estrutura->sentinelasColuna[v];
+        const Node *a = sentinelaLinha->direita, *b = sentinelaColuna->abaixo;
+
+        while (a != sentinelaLinha || b != sentinelaColuna)
+        {
+            int u;
+
+            if (b == sentinelaColuna || (a != sentinelaLinha && a->coluna < b->linha))
+            {
+                u = a->coluna;
+                a = a->direita;
+            }
+            else if (a == sentinelaLinha || b->linha < a->coluna)
+            {
+                u = b->linha;
+                b = b->abaixo;
+            }
+            else
+            {
+                u = a->coluna;
+                a = a->direita;
+                b = b->abaixo;
+            }
+
+            if (u != v)
+                visitar(u);
+        }
+    };
+
+    std::vector<int> grau(n + 1, 0);
+    for (int v = 1; v <= n; v++)
+        vizinhos(v, [&](const int &)
+                 { grau[v]++; });
+
+    auto menorGrau = [&grau](const int &a, const int &b)
+    { return grau[a] < grau[b]; };
+
+    // Estrutura de níveis a partir de raiz: retorna a profundidade e onde começa o último nível em fila
+    std::vector<int> marca(n + 1, 0), fila;
+    int geracao = 0;
+
+    auto niveis = [&](const int &raiz, size_t &inicioUltimo)
+    {
+        geracao++;
+        fila.clear();
+        fila.push_back(raiz);
+        marca[raiz] = geracao;
+
+        int profundidade = 0;
+        for (size_t inicio = 0; inicio < fila.size(); profundidade++)
+        {
+            const size_t fim = fila.size();
+            inicioUltimo = inicio;
+
+            for (size_t p = inicio; p < fim; p++)
+            {
+                // Cópia do vértice: push_back pode realocar fila enquanto vizinhos() ainda o usa
+                const int v = fila[p];
+                vizinhos(v, [&](const int &u)
+                         {
+                             if (marca[u] != geracao)
+                             {
+                                 marca[u] = geracao;
+                                 fila.push_back(u);
+                             } });
+            }
+
+            inicio = fim;
+        }
+
+        return profundidade;
+    };
+
+    // Cada componente começa pelo vértice de menor grau ainda não numerado
+    std::vector<int> candidatos(n);
+    for (int v = 1; v <= n; v++)
+        candidatos[v - 1] = v;
+    std::stable_sort(candidatos.begin(), candidatos.end(), menorGrau);
+
+    std::vector<int> ordem;
+    ordem.reserve(n);
+    std::vector<bool> numerado(n + 1, false);
+
+    for (const int &candidato : candidatos)
+    {
+        if (numerado[candidato])
+            continue;
+
+        // Vértice pseudo-periférico (George-Liu): troca a raiz enquanto a excentricidade aumentar
+        int raiz = candidato;
+        size_t inicioUltimo = 0;
+        int profundidade = niveis(raiz, inicioUltimo);
+
+        while (true)
+        {
+            const int extremo = *std::min_element(fila.begin() + inicioUltimo, fila.end(), menorGrau);
+            size_t inicioExtremo = 0;
+            const int profundidadeExtremo = niveis(extremo, inicioExtremo);
+
+            if (profundidadeExtremo <= profundidade)
+                break;
+
+            raiz = extremo;
+            profundidade = profundidadeExtremo;
+            inicioUltimo = inicioExtremo;
+        }
+
+        // Cuthill-McKee: busca em largura visitando os vizinhos em ordem crescente de grau
+        const size_t inicio = ordem.size();
+        ordem.push_back(raiz);
+        numerado[raiz] = true;
+
+        for (size_t p = inicio; p < ordem.size(); p++)
+        {
+            const size_t antes = ordem.size();
+
+            vizinhos(ordem[p], [&](const int &u)
+                     {
+                         if (!numerado[u])
+                         {
+                             numerado[u] = true;
+                             ordem.push_back(u);
+                         } });
+
+            std::stable_sort(ordem.begin() + antes, ordem.end(), menorGrau);
+        }
+    }
+
+    std::reverse(ordem.begin(), ordem.end());
+
+    Matriz permutada = applyPermutation(ordem, ordem);
+    return {std::move(ordem), std::move(permutada)};
+}
+
+VisaoMatriz Matriz::view(const int &linhaInicial, const int &linhaFinal, const int &colunaInicial, const int &colunaFinal) const
+{
+    return VisaoMatriz(*this, linhaInicial, linhaFinal, colunaInicial, colunaFinal);
+}
+
+int Matriz::larguraBanda() const
+{
+    int largura = 0;
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        const Node *sentinela = estrutura->sentinelasLinha[i];
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+            largura = std::max(largura, std::abs(i - no->coluna));
+    }
+
+    return largura;
+}
+
+size_t Matriz::perfil() const
+{
+    size_t total = 0;
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        const Node *primeiro = estrutura->sentinelasLinha[i]->direita;
+
+        if (primeiro != estrutura->sentinelasLinha[i] && primeiro->coluna < i)
+            total += i - primeiro->coluna;
+    }
+
+    return total;
+}
+
+namespace
+{
+    const size_t ELEMENTOS_POR_THREAD = 1 << 15; /**< Abaixo disso, criar threads custa mais do que a redução. */
+
+    /**
+     * @brief Soma pareada (pairwise) de valores[0, quantidade): metades somadas recursivamente, em ordem fixa.
+     */
+    double somaPareada(const double *valores, const size_t &quantidade)
+    {
+        if (quantidade <= 8)
+        {
+            double soma = 0.0;
+            for (size_t k = 0; k < quantidade; k++)
+                soma += valores[k];
+            return soma;
+        }
+
+        const size_t metade = quantidade / 2;
+        return somaPareada(valores, metade) + somaPareada(valores + metade, quantidade - metade);
+    }
+
+    double somaPareada(const std::vector<double> &valores)
+    {
+        return somaPareada(valores.data(), valores.size());
+    }
+
+    /**
+     * @brief Reduz cada lista (linha ou coluna) a um valor, com as listas divididas em faixas entre threads.
+     *
+     * \p reduzir recebe os valores de uma lista, em ordem, e pode alterá-los. Cada lista é reduzida
+     * por uma única thread e gravada na sua posição do resultado, de modo que o resultado não depende
+     * da divisão em faixas.
+     *
+     * @return Vetor em que a posição k - 1 corresponde à lista k.
+     */
+    template <typename Reduzir>
+    std::vector<double> reduzirListas(const EstruturaMatriz &estrutura, const bool &porColuna, unsigned threads, Reduzir reduzir)
+    {
+        const int listas = porColuna ? estrutura.colunas : estrutura.linhas;
+        const std::vector<Node *> &sentinelas = porColuna ? estrutura.sentinelasColuna : estrutura.sentinelasLinha;
+        const std::vector<std::atomic<int>> &elementosLista = porColuna ? estrutura.elementosColuna : estrutura.elementosLinha;
+        const size_t elementos = estrutura.elementos.load(std::memory_order_relaxed);
+
+        std::vector<double> resultado(listas, 0.0);
+
+        auto reduzirFaixa = [&](const int &inicio, const int &fim)
+        {
+            std::vector<double> valores; // Reaproveitado entre as listas da faixa
+            for (int k = inicio; k < fim; k++)
+            {
+                valores.clear();
+                const Node *sentinela = sentinelas[k];
+                if (porColuna)
+                {
+                    for (const Node *no = sentinela->abaixo; no != sentinela; no = no->abaixo)
+                        valores.push_back(no->valor);
+                }
+                else
+                {
+                    for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+                        valores.push_back(no->valor);
+                }
+
+                resultado[k - 1] = reduzir(valores);
+            }
+        };
+
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads = static_cast<unsigned>(std::min<size_t>({threads, static_cast<size_t>(std::max(listas, 1)), elementos / ELEMENTOS_POR_THREAD + 1}));
+
+        if (threads <= 1)
+        {
+            reduzirFaixa(1, listas + 1);
+            return resultado;
+        }
+
+        // Faixas [limites[t], limites[t + 1]) com aproximadamente a mesma quantidade de elementos
+        std::vector<int> limites{1};
+        size_t acumulado = 0;
+        for (int k = 1; k <= listas && limites.size() < threads; k++)
+        {
+            acumulado += elementosLista[k].load(std::memory_order_relaxed);
+            if (acumulado >= elementos * limites.size() / threads)
+                limites.push_back(k + 1);
+        }
+        limites.resize(threads + 1, listas + 1);
+
+        std::vector<std::thread> trabalhadores;
+        for (unsigned t = 1; t < threads; t++)
+            trabalhadores.emplace_back(reduzirFaixa, limites[t], limites[t + 1]);
+
+        reduzirFaixa(limites[0], limites[1]);
+
+        for (std::thread &trabalhador : trabalhadores)
+            trabalhador.join();
+
+        return resultado;
+    }
+
+    /**
+     * @brief Soma pareada dos valores absolutos de uma lista.
+     */
+    double somaAbsoluta(std::vector<double> &valores)
+    {
+        for (double &valor : valores)
+            valor = std::abs(valor);
+
+        return somaPareada(valores);
+    }
+}
+
+std::vector<double> Matriz::somaLinhas(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    return reduzirListas(*estrutura, false, threads, [](std::vector<double> &valores)
+                         { return somaPareada(valores); });
+}
+
+std::vector<double> Matriz::somaColunas(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    return reduzirListas(*estrutura, true, threads, [](std::vector<double> &valores)
+                         { return somaPareada(valores); });
+}
+
+double Matriz::norma1(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    const std::vector<double> somas = reduzirListas(*estrutura, true, threads, somaAbsoluta);
+
+    return somas.empty() ? 0.0 : *std::max_element(somas.begin(), somas.end());
+}
+
+double Matriz::normaInfinito(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    const std::vector<double> somas = reduzirListas(*estrutura, false, threads, somaAbsoluta);
+
+    return somas.empty() ? 0.0 : *std::max_element(somas.begin(), somas.end());
+}
+
+double Matriz::normaFrobenius(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    const std::vector<double> quadrados = reduzirListas(*estrutura, false, threads, [](std::vector<double> &valores)
+                                                        {
+                                                            for (double &valor : valores)
+                                                                valor *= valor;
+                                                            return somaPareada(valores); });
+
+    return std::sqrt(somaPareada(quadrados));
+}
+
+double Matriz::traco() const
+{
+    if (getLinhas() != getColunas())
+        throw std::invalid_argument("Erro: O traço exige uma matriz quadrada");
+
+    auto adquiridas = travarTodas(travas.get());
+    std::vector<double> diagonal(getLinhas(), 0.0);
+
+    // Cada linha é percorrida apenas até a coluna da diagonal
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        const Node *sentinela = estrutura->sentinelasLinha[i];
+        const Node *no = sentinela->direita;
+        while (no != sentinela && no->coluna < i)
+            no = no->direita;
+
+        if (no != sentinela && no->coluna == i)
+            diagonal[i - 1] = no->valor;
+    }
+
+    return somaPareada(diagonal);
+}
+
+double Matriz::minimo(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    const int colunas = getColunas();
+
+    // Uma linha com menos elementos do que colunas também contém zeros
+    const std::vector<double> menores = reduzirListas(*estrutura, false, threads, [&colunas](std::vector<double> &valores)
+                                                      {
+                                                          double menor = valores.size() < static_cast<size_t>(colunas) ? 0.0 : valores.front();
+                                                          for (const double &valor : valores)
+                                                              menor = std::min(menor, valor);
+                                                          return menor; });
+
+    return menores.empty() ? 0.0 : *std::min_element(menores.begin(), menores.end());
+}
+
+double Matriz::maximo(unsigned threads) const
+{
+    auto adquiridas = travarTodas(travas.get());
+    const int colunas = getColunas();
+
+    const std::vector<double> maiores = reduzirListas(*estrutura, false, threads, [&colunas](std::vector<double> &valores)
+                                                      {
+                                                          double maior = valores.size() < static_cast<size_t>(colunas) ? 0.0 : valores.front();
+                                                          for (const double &valor : valores)
+                                                              maior = std::max(maior, valor);
+                                                          return maior; });
+
+    return maiores.empty() ? 0.0 : *std::max_element(maiores.begin(), maiores.end());
+}
+
+double Matriz::get(const int &posI, const int &posJ)
+{
+    return static_cast<const Matriz &>(*this).get(posI, posJ);
+}
+
+double Matriz::get(const int &posI, const int &posJ) const
+{
+    if (posI <= 0 || posI > getLinhas() || posJ <= 0 || posJ > getColunas())
+        throw std::invalid_argument("Erro: Local de acesso inválido");
+
+    std::unique_lock<std::mutex> travaLinha;
+    if (travas)
+        travaLinha = std::unique_lock<std::mutex>(travas->linhas[posI % travas->linhas.size()]);
+
+    const Node *linhaAtual = estrutura->sentinelasLinha[posI];
+
+    // Avança na linha enquanto o nó atual estiver "antes" da coluna desejada.
+    const Node *aux = linhaAtual->direita;
+    while (aux != linhaAtual && aux->coluna < posJ)
+    {
+        aux = aux->direita;
+    }
+
+    // Se o nó atual corresponde exatamente à posição, retorna o valor.
+    if (aux != linhaAtual && aux->coluna == posJ)
+        return aux->valor;
+
+    return 0;
+}
+
+void Matriz::print() const
+{
+    ConstIteratorM it = begin();
+
+    for (int i = 1, linhas = getLinhas(); i <= linhas; i++)
     {
-        for (int j = 1; j <= colunas; j++)
+        for (int j = 1, colunas = getColunas(); j <= colunas; j++)
         {
-            if (it.current->linha == i && it.current->coluna == j)
+            if (it.linha() == i && it.coluna() == j)
             {
                 std::cout << std::fixed << std::setprecision(1) << *it;
                 ++it;
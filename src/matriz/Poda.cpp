@@ -0,0 +1,51 @@
+#include "matriz/Poda.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+PodaLinha::PodaLinha(const OpcoesPoda &opcoes, std::vector<double> &valores) : tolerancia(opcoes.tolerancia)
+{
+    if (opcoes.maximoPorLinha == 0 || valores.size() <= opcoes.maximoPorLinha)
+        return;
+
+    // Magnitudes dos elementos que passam pela tolerância
+    size_t restantes = 0;
+    for (const double &valor : valores)
+    {
+        const double magnitude = std::abs(valor);
+        if (magnitude != 0 && magnitude >= tolerancia)
+            valores[restantes++] = magnitude;
+    }
+    valores.resize(restantes);
+
+    if (valores.size() <= opcoes.maximoPorLinha)
+        return;
+
+    std::nth_element(valores.begin(), valores.begin() + (opcoes.maximoPorLinha - 1), valores.end(), std::greater<double>());
+    limiar = valores[opcoes.maximoPorLinha - 1];
+
+    // Após nth_element, os maiores que o limiar estão todos antes dele
+    const size_t maiores = std::count_if(valores.begin(), valores.begin() + (opcoes.maximoPorLinha - 1), [this](const double &magnitude)
+                                         { return magnitude > limiar; });
+    empates = opcoes.maximoPorLinha - maiores;
+    limitada = true;
+}
+
+bool PodaLinha::manter(const double &valor)
+{
+    const double magnitude = std::abs(valor);
+
+    if (magnitude == 0 || magnitude < tolerancia)
+        return false;
+
+    if (!limitada || magnitude > limiar)
+        return true;
+
+    if (magnitude == limiar && empates > 0)
+    {
+        empates--;
+        return true;
+    }
+
+    return false;
+}
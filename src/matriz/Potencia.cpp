@@ -0,0 +1,194 @@
+#include "matriz/Potencia.hpp"
+#include "matriz/ProdutoEsparso.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <optional>
+
+namespace
+{
+    /**
+     * @brief Compara as posições (e, se \p valores, também os valores) de duas matrizes de mesmo tamanho.
+     */
+    bool mesmosElementos(const Matriz &matrizA, const Matriz &matrizB, bool valores)
+    {
+        if (matrizA.quantidade() != matrizB.quantidade())
+            return false;
+
+        for (int i = 1; i <= matrizA.getLinhas(); i++)
+        {
+            const Node *sentinelaA = matrizA.getSentinelaLinha(i);
+            const Node *sentinelaB = matrizB.getSentinelaLinha(i);
+            const Node *a = sentinelaA->direita, *b = sentinelaB->direita;
+
+            for (; a != sentinelaA && b != sentinelaB; a = a->direita, b = b->direita)
+            {
+                if (a->coluna != b->coluna || (valores && a->valor != b->valor))
+                    return false;
+            }
+
+            if (a != sentinelaA || b != sentinelaB)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Aplica o gancho de poda se a matriz ultrapassar o limite de elementos.
+     *
+     * @return true se a poda foi aplicada.
+     */
+    bool podar(Matriz &matriz, const OpcoesPotencia &opcoes)
+    {
+        if (!opcoes.poda || opcoes.limiteElementos == 0 || matriz.quantidade() <= opcoes.limiteElementos)
+            return false;
+
+        opcoes.poda(matriz);
+        return true;
+    }
+
+    /**
+     * @brief Retorna A^(2^t) para ser guardada em resultado.
+     *
+     * A base é apenas compartilhada. Um buffer de quadrados é copiado em ordem de linhas, sem os zeros
+     * guardados: compartilhado com resultado, ele seria separado por inteiro (e teria os nós
+     * revinculados) na próxima chamada a calcular().
+     */
+    Matriz fatorAtual(const Matriz *atual, const Matriz &base)
+    {
+        if (atual == &base)
+            return base;
+
+        ConstrutorMatriz copia(atual->getLinhas(), atual->getColunas());
+        copia.reservar(atual->quantidade());
+
+        for (int i = 1; i <= atual->getLinhas(); i++)
+        {
+            const Node *sentinela = atual->getSentinelaLinha(i);
+            for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+                copia.adicionar(i, no->coluna, no->valor);
+        }
+
+        return copia.construir();
+    }
+}
+
+Matriz power(const Matriz &matriz, const int &expoente, const OpcoesPotencia &opcoes)
+{
+    if (matriz.getLinhas() != matriz.getColunas())
+        throw std::invalid_argument("Erro: A potência exige uma matriz quadrada");
+
+    if (expoente < 0)
+        throw std::invalid_argument("Erro: Expoente negativo");
+
+    const int n = matriz.getLinhas();
+
+    if (expoente == 0)
+    {
+        ConstrutorMatriz identidade(n, n);
+        for (int i = 1; i <= n; i++)
+            identidade.adicionar(i, i, 1.0);
+
+        return identidade.construir();
+    }
+
+    EspacoProduto espaco;
+
+    Matriz base = matriz;         // A^(2^t) enquanto o padrão ainda muda
+    const Matriz *atual = &base;  // A^(2^t): base ou um dos buffers de quadrados
+    Matriz resultado;
+    bool temResultado = false;
+
+    // Quadrados com padrão fixo: dois buffers alternados, um lido e outro regravado
+    std::optional<ProdutoEsparso> quadrados[2];
+    int proximo = 0;
+    bool padraoEstavel = false;
+    bool estruturaAberta = false; // O produto simbólico do padrão estável tem posições a mais
+
+    for (int k = expoente;;)
+    {
+        if (k & 1)
+        {
+            if (!temResultado)
+            {
+                resultado = fatorAtual(atual, base);
+            }
+            else
+            {
+                resultado = multiplicarEsparso(resultado, *atual, espaco);
+                podar(resultado, opcoes);
+            }
+
+            temResultado = true;
+        }
+
+        k >>= 1;
+        if (k == 0)
+            break;
+
+        const Matriz *quadrado = nullptr;
+
+        if (padraoEstavel)
+        {
+            if (!quadrados[proximo])
+            {
+                quadrados[proximo].emplace(*atual, *atual);
+
+                // Só é seguro reaproveitar a estrutura se o padrão simbólico for o mesmo padrão numérico
+                if (quadrados[proximo]->quantidade() != atual->quantidade())
+                {
+                    quadrados[0].reset();
+                    quadrados[1].reset();
+                    padraoEstavel = false;
+                    estruturaAberta = true;
+                }
+            }
+            else
+            {
+                quadrados[proximo]->calcular(*atual, *atual);
+            }
+
+            if (padraoEstavel)
+            {
+                quadrado = &quadrados[proximo]->getResultado();
+                proximo ^= 1;
+            }
+        }
+
+        if (quadrado == nullptr)
+        {
+            Matriz novo = multiplicarEsparso(*atual, *atual, espaco);
+            const bool podou = podar(novo, opcoes);
+
+            padraoEstavel = !podou && !estruturaAberta && mesmosElementos(novo, *atual, false);
+
+            // P * P == P: todas as potências seguintes de P são iguais a P
+            if (mesmosElementos(novo, *atual, true))
+            {
+                resultado = temResultado ? multiplicarEsparso(resultado, *atual, espaco) : fatorAtual(atual, base);
+                podar(resultado, opcoes);
+                temResultado = true;
+                break;
+            }
+
+            base = std::move(novo);
+            quadrado = &base;
+        }
+        else if (mesmosElementos(*quadrado, *atual, true))
+        {
+            resultado = temResultado ? multiplicarEsparso(resultado, *atual, espaco) : fatorAtual(atual, base);
+            temResultado = true;
+            break;
+        }
+
+        // Potência nula: todas as seguintes também são, e ainda resta ao menos um fator
+        if (quadrado->quantidade() == 0)
+            return Matriz(n, n);
+
+        atual = quadrado;
+    }
+
+    // Resultados vindos dos buffers podem guardar cancelamentos como zero; prune() os remove em uma passada
+    resultado.prune(0.0);
+
+    return resultado;
+}
@@ -0,0 +1,282 @@
+#include "matriz/ProdutoEsparso.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <algorithm>
+#include <optional>
+
+ProdutoEsparso::ProdutoEsparso(const Matriz &matrizA, const Matriz &matrizB)
+    : linhas(matrizA.getLinhas()), internas(matrizA.getColunas()), colunas(matrizB.getColunas()), geracao(0)
+{
+    if (matrizA.getColunas() != matrizB.getLinhas())
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    acumulador.assign(colunas + 1, 0.0);
+    marca.assign(colunas + 1, 0);
+
+    // Fase simbólica: colunas alcançadas por cada linha de A através das linhas de B
+    ConstrutorMatriz construtor(linhas, colunas);
+    std::vector<int> colunasLinha;
+
+    for (int i = 1; i <= linhas; i++)
+    {
+        geracao++;
+        colunasLinha.clear();
+
+        const Node *sentinelaA = matrizA.getSentinelaLinha(i);
+        for (const Node *a = sentinelaA->direita; a != sentinelaA; a = a->direita)
+        {
+            const Node *sentinelaB = matrizB.getSentinelaLinha(a->coluna);
+            for (const Node *b = sentinelaB->direita; b != sentinelaB; b = b->direita)
+            {
+                if (marca[b->coluna] != geracao)
+                {
+                    marca[b->coluna] = geracao;
+                    colunasLinha.push_back(b->coluna);
+                }
+            }
+        }
+
+        std::sort(colunasLinha.begin(), colunasLinha.end());
+
+        // Valor provisório diferente de zero; a fase numérica o substitui
+        for (const int &coluna : colunasLinha)
+            construtor.adicionar(i, coluna, 1.0);
+    }
+
+    resultado = construtor.construir();
+    vincularNos();
+
+    calcular(matrizA, matrizB);
+}
+
+void ProdutoEsparso::vincularNos()
+{
+    nos.clear();
+    inicioLinha.assign(linhas + 1, 0);
+
+    for (int i = 1; i <= linhas; i++)
+    {
+        Node *sentinela = resultado.estrutura->sentinelasLinha[i];
+        for (Node *no = sentinela->direita; no != sentinela; no = no->direita)
+            nos.push_back(no);
+
+        inicioLinha[i] = nos.size();
+    }
+}
+
+const Matriz &ProdutoEsparso::calcular(const Matriz &matrizA, const Matriz &matrizB)
+{
+    if (matrizA.getLinhas() != linhas || matrizA.getColunas() != internas || matrizB.getColunas() != colunas)
+        throw std::invalid_argument("Erro: As dimensões das matrizes mudaram desde a fase simbólica");
+
+    // Uma cópia do resultado ainda aponta para os mesmos nós: separa antes de regravar.
+    // Sem cópias, alterar() apenas avança a versão do resultado
+    const bool compartilhada = resultado.compartilhada();
+    resultado.alterar();
+    if (compartilhada)
+        vincularNos();
+
+    for (int i = 1; i <= linhas; i++)
+    {
+        geracao++;
+
+        for (size_t p = inicioLinha[i - 1]; p < inicioLinha[i]; p++)
+            marca[nos[p]->coluna] = geracao;
+
+        const Node *sentinelaA = matrizA.getSentinelaLinha(i);
+        for (const Node *a = sentinelaA->direita; a != sentinelaA; a = a->direita)
+        {
+            const Node *sentinelaB = matrizB.getSentinelaLinha(a->coluna);
+            for (const Node *b = sentinelaB->direita; b != sentinelaB; b = b->direita)
+            {
+                if (marca[b->coluna] != geracao)
+                {
+                    std::fill(acumulador.begin(), acumulador.end(), 0.0);
+                    throw std::invalid_argument("Erro: O produto possui a posição (" + std::to_string(i) + ", " +
+                                                std::to_string(b->coluna) + ") fora do padrão da fase simbólica");
+                }
+
+                acumulador[b->coluna] += a->valor * b->valor;
+            }
+        }
+
+        for (size_t p = inicioLinha[i - 1]; p < inicioLinha[i]; p++)
+        {
+            nos[p]->valor = acumulador[nos[p]->coluna];
+            acumulador[nos[p]->coluna] = 0.0;
+        }
+    }
+
+    return resultado;
+}
+
+const Matriz &ProdutoEsparso::getResultado() const
+{
+    return resultado;
+}
+
+size_t ProdutoEsparso::quantidade() const
+{
+    return nos.size();
+}
+
+void EspacoProduto::preparar(const int &colunas)
+{
+    if (acumulador.size() < static_cast<size_t>(colunas) + 1)
+    {
+        acumulador.assign(colunas + 1, 0.0);
+        marca.assign(colunas + 1, 0);
+        geracao = 0;
+    }
+}
+
+namespace
+{
+    /**
+     * @brief Núcleo comum dos produtos linha a linha.
+     *
+     * Para cada linha i do resultado, \p contribuicoes(i, acumular) chama acumular(coluna, valor)
+     * para cada produto parcial; as colunas alcançadas são ordenadas e entregues ao construtor.
+     *
+     * @param simetrica Se verdadeiro, cada elemento (i, j) também é gravado em (j, i).
+     * @param opcoes Poda aplicada a cada linha antes de entregá-la ao construtor.
+     */
+    template <typename Contribuicoes>
+    Matriz produtoPorLinhas(const int &linhas, const int &colunas, EspacoProduto &espaco, bool simetrica, Contribuicoes contribuicoes,
+                            const OpcoesPoda &opcoes = {})
+    {
+        espaco.preparar(colunas);
+
+        ConstrutorMatriz construtor(linhas, colunas);
+
+        auto acumular = [&espaco](const int &coluna, const double &valor)
+        {
+            if (espaco.marca[coluna] != espaco.geracao)
+            {
+                espaco.marca[coluna] = espaco.geracao;
+                espaco.colunasLinha.push_back(coluna);
+            }
+
+            espaco.acumulador[coluna] += valor;
+        };
+
+        for (int i = 1; i <= linhas; i++)
+        {
+            espaco.geracao++;
+            espaco.colunasLinha.clear();
+
+            contribuicoes(i, acumular);
+
+            std::sort(espaco.colunasLinha.begin(), espaco.colunasLinha.end());
+
+            std::optional<PodaLinha> poda;
+            if (opcoes.ativa())
+            {
+                espaco.valoresLinha.clear();
+                for (const int &coluna : espaco.colunasLinha)
+                    espaco.valoresLinha.push_back(espaco.acumulador[coluna]);
+
+                poda.emplace(opcoes, espaco.valoresLinha);
+            }
+
+            // O construtor descarta as posições que se anularam
+            for (const int &coluna : espaco.colunasLinha)
+            {
+                if (poda && !poda->manter(espaco.acumulador[coluna]))
+                {
+                    espaco.acumulador[coluna] = 0.0;
+                    continue;
+                }
+
+                if (simetrica)
+                    construtor.adicionarSimetrico(i, coluna, espaco.acumulador[coluna]);
+                else
+                    construtor.adicionar(i, coluna, espaco.acumulador[coluna]);
+
+                espaco.acumulador[coluna] = 0.0;
+            }
+        }
+
+        return construtor.construir();
+    }
+}
+
+Matriz multiplicarEsparso(const Matriz &matrizA, const Matriz &matrizB, EspacoProduto &espaco, const OpcoesPoda &opcoes)
+{
+    if (matrizA.getColunas() != matrizB.getLinhas())
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    return produtoPorLinhas(matrizA.getLinhas(), matrizB.getColunas(), espaco, false, [&](const int &i, auto &acumular)
+                            {
+                                // Linha i de A * B: soma das linhas k de B ponderadas por A(i, k)
+                                const Node *sentinelaA = matrizA.getSentinelaLinha(i);
+                                for (const Node *a = sentinelaA->direita; a != sentinelaA; a = a->direita)
+                                {
+                                    const Node *sentinelaB = matrizB.getSentinelaLinha(a->coluna);
+                                    for (const Node *b = sentinelaB->direita; b != sentinelaB; b = b->direita)
+                                        acumular(b->coluna, a->valor * b->valor);
+                                } }, opcoes);
+}
+
+Matriz multiplicarEsparso(const VisaoMatriz &visaoA, const VisaoMatriz &visaoB, EspacoProduto &espaco, const OpcoesPoda &opcoes)
+{
+    if (visaoA.getColunas() != visaoB.getLinhas())
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    return produtoPorLinhas(visaoA.getLinhas(), visaoB.getColunas(), espaco, false, [&](const int &i, auto &acumular)
+                            {
+                                // Linha i de A * B restrita aos blocos: as colunas já vêm nos índices das visões
+                                for (VisaoMatriz::CursorLinha a = visaoA.linha(i); a.valido(); a.avancar())
+                                {
+                                    for (VisaoMatriz::CursorLinha b = visaoB.linha(a.coluna()); b.valido(); b.avancar())
+                                        acumular(b.coluna(), a.valor() * b.valor());
+                                } }, opcoes);
+}
+
+Matriz multiplicarTranspostaA(const Matriz &matrizA, const Matriz &matrizB, EspacoProduto &espaco)
+{
+    if (matrizA.getLinhas() != matrizB.getLinhas())
+        throw std::invalid_argument("Erro: As matrizes A e B precisam ter o mesmo número de linhas");
+
+    return produtoPorLinhas(matrizA.getColunas(), matrizB.getColunas(), espaco, false, [&](const int &i, auto &acumular)
+                            {
+                                // Linha i de Aᵀ * B: soma das linhas k de B ponderadas por A(k, i), percorrendo a coluna i de A
+                                const Node *sentinelaA = matrizA.getSentinelaColuna(i);
+                                for (const Node *a = sentinelaA->abaixo; a != sentinelaA; a = a->abaixo)
+                                {
+                                    const Node *sentinelaB = matrizB.getSentinelaLinha(a->linha);
+                                    for (const Node *b = sentinelaB->direita; b != sentinelaB; b = b->direita)
+                                        acumular(b->coluna, a->valor * b->valor);
+                                } });
+}
+
+Matriz multiplicarTranspostaB(const Matriz &matrizA, const Matriz &matrizB, EspacoProduto &espaco)
+{
+    if (matrizA.getColunas() != matrizB.getColunas())
+        throw std::invalid_argument("Erro: As matrizes A e B precisam ter o mesmo número de colunas");
+
+    return produtoPorLinhas(matrizA.getLinhas(), matrizB.getLinhas(), espaco, false, [&](const int &i, auto &acumular)
+                            {
+                                // Linha i de A * Bᵀ: soma das colunas k de B (como linhas) ponderadas por A(i, k)
+                                const Node *sentinelaA = matrizA.getSentinelaLinha(i);
+                                for (const Node *a = sentinelaA->direita; a != sentinelaA; a = a->direita)
+                                {
+                                    const Node *sentinelaB = matrizB.getSentinelaColuna(a->coluna);
+                                    for (const Node *b = sentinelaB->abaixo; b != sentinelaB; b = b->abaixo)
+                                        acumular(b->linha, a->valor * b->valor);
+                                } });
+}
+
+Matriz multiplicarGram(const Matriz &matriz, EspacoProduto &espaco, bool apenasTrianguloSuperior)
+{
+    return produtoPorLinhas(matriz.getColunas(), matriz.getColunas(), espaco, !apenasTrianguloSuperior, [&](const int &i, auto &acumular)
+                            {
+                                // Linha i de Aᵀ * A, apenas colunas j >= i: para cada A(k, i) da coluna i, o restante
+                                // da linha k começa no próprio nó, pois ele é o mesmo nas duas listas
+                                const Node *sentinelaColuna = matriz.getSentinelaColuna(i);
+                                for (const Node *a = sentinelaColuna->abaixo; a != sentinelaColuna; a = a->abaixo)
+                                {
+                                    const Node *sentinelaLinha = matriz.getSentinelaLinha(a->linha);
+                                    for (const Node *b = a; b != sentinelaLinha; b = b->direita)
+                                        acumular(b->coluna, a->valor * b->valor);
+                                } });
+}
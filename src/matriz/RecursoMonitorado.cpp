@@ -0,0 +1,96 @@
+#include "matriz/RecursoMonitorado.hpp"
+#include <new>
+#include <stdexcept>
+
+RecursoMonitorado::RecursoMonitorado(const size_t &limiteBytes, std::pmr::memory_resource *origem)
+    : origem(origem), limite(limiteBytes)
+{
+    if (origem == nullptr)
+        throw std::invalid_argument("Erro: Recurso de memória de origem nulo");
+}
+
+void *RecursoMonitorado::do_allocate(std::size_t bytes, std::size_t alinhamento)
+{
+    // Reserva antes de alocar, para que threads concorrentes não ultrapassem o limite juntas
+    const size_t emUso = bytesEmUso.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    const size_t limiteAtual = limite.load(std::memory_order_relaxed);
+
+    if (limiteAtual != 0 && emUso > limiteAtual)
+    {
+        bytesEmUso.fetch_sub(bytes, std::memory_order_relaxed);
+        recusadas.fetch_add(1, std::memory_order_relaxed);
+        throw std::bad_alloc();
+    }
+
+    void *ponteiro;
+    try
+    {
+        ponteiro = origem->allocate(bytes, alinhamento);
+    }
+    catch (...)
+    {
+        bytesEmUso.fetch_sub(bytes, std::memory_order_relaxed);
+        throw;
+    }
+
+    alocacoes.fetch_add(1, std::memory_order_relaxed);
+
+    size_t pico = picoBytes.load(std::memory_order_relaxed);
+    while (emUso > pico && !picoBytes.compare_exchange_weak(pico, emUso, std::memory_order_relaxed))
+    {
+    }
+
+    return ponteiro;
+}
+
+void RecursoMonitorado::do_deallocate(void *ponteiro, std::size_t bytes, std::size_t alinhamento)
+{
+    origem->deallocate(ponteiro, bytes, alinhamento);
+    bytesEmUso.fetch_sub(bytes, std::memory_order_relaxed);
+    desalocacoes.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool RecursoMonitorado::do_is_equal(const std::pmr::memory_resource &outro) const noexcept
+{
+    return this == &outro;
+}
+
+size_t RecursoMonitorado::getBytesEmUso() const
+{
+    return bytesEmUso.load(std::memory_order_relaxed);
+}
+
+size_t RecursoMonitorado::getPicoBytes() const
+{
+    return picoBytes.load(std::memory_order_relaxed);
+}
+
+size_t RecursoMonitorado::getAlocacoes() const
+{
+    return alocacoes.load(std::memory_order_relaxed);
+}
+
+size_t RecursoMonitorado::getDesalocacoes() const
+{
+    return desalocacoes.load(std::memory_order_relaxed);
+}
+
+size_t RecursoMonitorado::getRecusadas() const
+{
+    return recusadas.load(std::memory_order_relaxed);
+}
+
+size_t RecursoMonitorado::getLimite() const
+{
+    return limite.load(std::memory_order_relaxed);
+}
+
+void RecursoMonitorado::setLimite(const size_t &limiteBytes)
+{
+    limite.store(limiteBytes, std::memory_order_relaxed);
+}
+
+void RecursoMonitorado::reiniciarPico()
+{
+    picoBytes.store(bytesEmUso.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
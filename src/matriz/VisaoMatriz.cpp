@@ -0,0 +1,219 @@
+#include "matriz/VisaoMatriz.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <iomanip>
+#include <stdexcept>
+
+VisaoMatriz::VisaoMatriz(const Matriz &matriz)
+    : base(matriz), linhaInicial(1), linhaFinal(matriz.getLinhas()), colunaInicial(1), colunaFinal(matriz.getColunas())
+{
+}
+
+VisaoMatriz::VisaoMatriz(const Matriz &matriz, const int &linhaInicial, const int &linhaFinal, const int &colunaInicial, const int &colunaFinal)
+    : base(matriz), linhaInicial(linhaInicial), linhaFinal(linhaFinal), colunaInicial(colunaInicial), colunaFinal(colunaFinal)
+{
+    if (linhaInicial < 1 || linhaInicial > linhaFinal || linhaFinal > matriz.getLinhas() ||
+        colunaInicial < 1 || colunaInicial > colunaFinal || colunaFinal > matriz.getColunas())
+        throw std::invalid_argument("Erro: Faixa da visão fora dos limites da matriz");
+
+    indexarLinhas();
+}
+
+void VisaoMatriz::indexarLinhas()
+{
+    // Começando na coluna 1, o primeiro nó de cada linha já é o primeiro da visão
+    if (colunaInicial == 1)
+        return;
+
+    // Custo de cada percurso, limitado pelos contadores mantidos pela matriz
+    size_t custoLinhas = 0, custoColunas = 0;
+    for (int i = linhaInicial; i <= linhaFinal; i++)
+        custoLinhas += base.quantidadeLinha(i);
+    for (int j = colunaInicial; j <= colunaFinal; j++)
+        custoColunas += base.quantidadeColuna(j);
+
+    inicioLinha.resize(getLinhas());
+
+    if (custoLinhas <= custoColunas)
+    {
+        // Avança cada linha até a primeira coluna da faixa
+        for (int i = linhaInicial; i <= linhaFinal; i++)
+        {
+            const Node *sentinela = base.getSentinelaLinha(i);
+            const Node *no = sentinela->direita;
+            while (no != sentinela && no->coluna < colunaInicial)
+                no = no->direita;
+
+            inicioLinha[i - linhaInicial] = no;
+        }
+        return;
+    }
+
+    // Desce as colunas da faixa em ordem crescente: o primeiro nó encontrado de cada linha é o de menor coluna
+    for (int i = linhaInicial; i <= linhaFinal; i++)
+        inicioLinha[i - linhaInicial] = base.getSentinelaLinha(i);
+
+    for (int j = colunaInicial; j <= colunaFinal; j++)
+    {
+        const Node *sentinela = base.getSentinelaColuna(j);
+        for (const Node *no = sentinela->abaixo; no != sentinela && no->linha <= linhaFinal; no = no->abaixo)
+        {
+            if (no->linha < linhaInicial)
+                continue;
+
+            const Node *&inicio = inicioLinha[no->linha - linhaInicial];
+            if (inicio->coluna == 0)
+                inicio = no;
+        }
+    }
+}
+
+int VisaoMatriz::getLinhas() const
+{
+    return linhaFinal - linhaInicial + 1;
+}
+
+int VisaoMatriz::getColunas() const
+{
+    return colunaFinal - colunaInicial + 1;
+}
+
+VisaoMatriz::CursorLinha VisaoMatriz::linha(const int &posI) const
+{
+    if (posI <= 0 || posI > getLinhas())
+        throw std::invalid_argument("Erro: Linha inválida");
+
+    const Node *sentinela = base.getSentinelaLinha(linhaInicial + posI - 1);
+    const Node *inicio = inicioLinha.empty() ? sentinela->direita : inicioLinha[posI - 1];
+
+    return CursorLinha(inicio, sentinela, colunaFinal, colunaInicial - 1);
+}
+
+double VisaoMatriz::get(const int &posI, const int &posJ) const
+{
+    if (posJ <= 0 || posJ > getColunas())
+        throw std::invalid_argument("Erro: Coluna inválida");
+
+    for (CursorLinha cursor = linha(posI); cursor.valido() && cursor.coluna() <= posJ; cursor.avancar())
+    {
+        if (cursor.coluna() == posJ)
+            return cursor.valor();
+    }
+
+    return 0;
+}
+
+size_t VisaoMatriz::quantidade() const
+{
+    size_t total = 0;
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        for (CursorLinha cursor = linha(i); cursor.valido(); cursor.avancar())
+            total++;
+    }
+
+    return total;
+}
+
+VisaoMatriz VisaoMatriz::view(const int &linhaInicial, const int &linhaFinal, const int &colunaInicial, const int &colunaFinal) const
+{
+    if (linhaInicial < 1 || linhaInicial > linhaFinal || linhaFinal > getLinhas() ||
+        colunaInicial < 1 || colunaInicial > colunaFinal || colunaFinal > getColunas())
+        throw std::invalid_argument("Erro: Faixa da visão fora dos limites da matriz");
+
+    return VisaoMatriz(base, this->linhaInicial + linhaInicial - 1, this->linhaInicial + linhaFinal - 1,
+                       this->colunaInicial + colunaInicial - 1, this->colunaInicial + colunaFinal - 1);
+}
+
+Matriz VisaoMatriz::materialize(std::pmr::memory_resource *recurso) const
+{
+    ConstrutorMatriz construtor(getLinhas(), getColunas());
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        for (CursorLinha cursor = linha(i); cursor.valido(); cursor.avancar())
+            construtor.adicionar(i, cursor.coluna(), cursor.valor());
+    }
+
+    return construtor.construir(recurso);
+}
+
+void VisaoMatriz::multiplicar(const std::vector<double> &x, std::vector<double> &y) const
+{
+    if (x.size() != static_cast<size_t>(getColunas()))
+        throw std::invalid_argument("Erro: O vetor precisa ter o mesmo tamanho que o número de colunas");
+
+    y.assign(getLinhas(), 0.0);
+
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        double soma = 0.0;
+        for (CursorLinha cursor = linha(i); cursor.valido(); cursor.avancar())
+            soma += cursor.valor() * x[cursor.coluna() - 1];
+
+        y[i - 1] = soma;
+    }
+}
+
+void VisaoMatriz::print() const
+{
+    for (int i = 1; i <= getLinhas(); i++)
+    {
+        CursorLinha cursor = linha(i);
+
+        for (int j = 1; j <= getColunas(); j++)
+        {
+            if (cursor.valido() && cursor.coluna() == j)
+            {
+                std::cout << std::fixed << std::setprecision(1) << cursor.valor();
+                cursor.avancar();
+            }
+            else
+            {
+                std::cout << "0.0";
+            }
+            std::cout << " ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+const Matriz &VisaoMatriz::getBase() const
+{
+    return base;
+}
+
+Matriz somarVisoes(const VisaoMatriz &visaoA, const VisaoMatriz &visaoB)
+{
+    if (visaoA.getLinhas() != visaoB.getLinhas() || visaoA.getColunas() != visaoB.getColunas())
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho");
+
+    ConstrutorMatriz construtor(visaoA.getLinhas(), visaoA.getColunas());
+
+    for (int i = 1; i <= visaoA.getLinhas(); i++)
+    {
+        VisaoMatriz::CursorLinha a = visaoA.linha(i), b = visaoB.linha(i);
+
+        // Intercalação das duas linhas, já em ordem de coluna; o construtor descarta as somas nulas
+        while (a.valido() || b.valido())
+        {
+            if (!b.valido() || (a.valido() && a.coluna() < b.coluna()))
+            {
+                construtor.adicionar(i, a.coluna(), a.valor());
+                a.avancar();
+            }
+            else if (!a.valido() || b.coluna() < a.coluna())
+            {
+                construtor.adicionar(i, b.coluna(), b.valor());
+                b.avancar();
+            }
+            else
+            {
+                construtor.adicionar(i, a.coluna(), a.valor() + b.valor());
+                a.avancar();
+                b.avancar();
+            }
+        }
+    }
+
+    return construtor.construir();
+}
@@ -0,0 +1,123 @@
+#include "matrizCSR/MatrizCSR.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+    const size_t ELEMENTOS_POR_THREAD = 1 << 15; /**< Abaixo disso, criar threads custa mais do que o produto. */
+}
+
+MatrizCSR::MatrizCSR(const Matriz &origem) : linhas(origem.getLinhas()), colunas(origem.getColunas())
+{
+    inicioLinha.reserve(linhas + 1);
+    inicioLinha.push_back(0);
+
+    for (int i = 1; i <= linhas; i++)
+    {
+        const Node *sentinela = origem.getSentinelaLinha(i);
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+        {
+            indicesColuna.push_back(no->coluna - 1);
+            valores.push_back(no->valor);
+        }
+
+        inicioLinha.push_back(valores.size());
+    }
+}
+
+int MatrizCSR::getLinhas() const
+{
+    return linhas;
+}
+
+int MatrizCSR::getColunas() const
+{
+    return colunas;
+}
+
+size_t MatrizCSR::quantidade() const
+{
+    return valores.size();
+}
+
+void MatrizCSR::multiplicarFaixa(const std::vector<double> &x, std::vector<double> &y, const int &inicio, const int &fim) const
+{
+    for (int i = inicio; i < fim; i++)
+    {
+        double soma = 0.0;
+
+        for (size_t p = inicioLinha[i]; p < inicioLinha[i + 1]; p++)
+            soma += valores[p] * x[indicesColuna[p]];
+
+        y[i] = soma;
+    }
+}
+
+void MatrizCSR::multiplicar(const std::vector<double> &x, std::vector<double> &y, unsigned threads) const
+{
+    if (x.size() != static_cast<size_t>(colunas))
+        throw std::invalid_argument("Erro: O vetor precisa ter o mesmo tamanho que o número de colunas");
+
+    y.resize(linhas);
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    threads = static_cast<unsigned>(std::min<size_t>({threads, static_cast<size_t>(linhas), valores.size() / ELEMENTOS_POR_THREAD + 1}));
+
+    if (threads <= 1)
+    {
+        multiplicarFaixa(x, y, 0, linhas);
+        return;
+    }
+
+    // Faixas de linhas com aproximadamente a mesma quantidade de elementos
+    std::vector<int> limites{0};
+    for (unsigned t = 1; t < threads; t++)
+    {
+        const size_t alvo = valores.size() * t / threads;
+        const int linha = static_cast<int>(std::lower_bound(inicioLinha.begin(), inicioLinha.end(), alvo) - inicioLinha.begin());
+        limites.push_back(std::clamp(linha, limites.back(), linhas));
+    }
+    limites.push_back(linhas);
+
+    std::vector<std::thread> trabalhadores;
+    for (unsigned t = 1; t < threads; t++)
+        trabalhadores.emplace_back(&MatrizCSR::multiplicarFaixa, this, std::cref(x), std::ref(y), limites[t], limites[t + 1]);
+
+    multiplicarFaixa(x, y, limites[0], limites[1]);
+
+    for (std::thread &trabalhador : trabalhadores)
+        trabalhador.join();
+}
+
+std::vector<double> MatrizCSR::diagonal() const
+{
+    std::vector<double> resultado(std::min(linhas, colunas), 0.0);
+
+    for (int i = 0; i < static_cast<int>(resultado.size()); i++)
+    {
+        auto inicio = indicesColuna.begin() + inicioLinha[i], fim = indicesColuna.begin() + inicioLinha[i + 1];
+        auto posicao = std::lower_bound(inicio, fim, i);
+
+        if (posicao != fim && *posicao == i)
+            resultado[i] = valores[posicao - indicesColuna.begin()];
+    }
+
+    return resultado;
+}
+
+const std::vector<size_t> &MatrizCSR::getInicioLinha() const
+{
+    return inicioLinha;
+}
+
+const std::vector<int> &MatrizCSR::getIndicesColuna() const
+{
+    return indicesColuna;
+}
+
+const std::vector<double> &MatrizCSR::getValores() const
+{
+    return valores;
+}
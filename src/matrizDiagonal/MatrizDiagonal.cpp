@@ -0,0 +1,363 @@
+#include "matrizDiagonal/MatrizDiagonal.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include "matriz/ProdutoEsparso.hpp"
+#include <algorithm>
+
+namespace
+{
+    /**
+     * @brief Quantidade de posições da diagonal de deslocamento \p k que caem dentro da matriz.
+     */
+    size_t comprimentoDiagonal(const int &linhas, const int &colunas, const int &k)
+    {
+        const int inicio = std::max(0, -k);
+        const int fim = std::min(linhas, colunas - k);
+        return fim > inicio ? static_cast<size_t>(fim - inicio) : 0;
+    }
+
+    /**
+     * @brief Núcleo comum da detecção: marca as diagonais ocupadas e mede o preenchimento.
+     *
+     * \p percorrer(visitar) chama visitar(i, j) para cada elemento não nulo (índices a partir de 1).
+     *
+     * @return Os deslocamentos ocupados, em ordem crescente, ou vazio se o preenchimento não bastar.
+     */
+    template <typename Percorrer>
+    std::vector<int> diagonaisOcupadas(const int &linhas, const int &colunas, const double &preenchimentoMinimo,
+                                       Percorrer percorrer)
+    {
+        // Deslocamento k = j - i ocupa a posição k + linhas - 1
+        std::vector<bool> ocupada(static_cast<size_t>(linhas) + colunas - 1, false);
+        size_t elementos = 0;
+
+        percorrer([&](const int &i, const int &j)
+                  {
+                      ocupada[j - i + linhas - 1] = true;
+                      elementos++; });
+
+        std::vector<int> deslocamentos;
+        size_t posicoes = 0;
+
+        for (size_t p = 0; p < ocupada.size(); p++)
+        {
+            if (ocupada[p])
+            {
+                deslocamentos.push_back(static_cast<int>(p) - linhas + 1);
+                posicoes += comprimentoDiagonal(linhas, colunas, deslocamentos.back());
+            }
+        }
+
+        if (posicoes == 0 || static_cast<double>(elementos) < preenchimentoMinimo * static_cast<double>(posicoes))
+            deslocamentos.clear();
+
+        return deslocamentos;
+    }
+
+    /**
+     * @brief Diagonais ocupadas pelos elementos de uma Matriz (veja diagonaisOcupadas()).
+     */
+    std::vector<int> diagonaisDaMatriz(const Matriz &origem, const double &preenchimentoMinimo)
+    {
+        return diagonaisOcupadas(origem.getLinhas(), origem.getColunas(), preenchimentoMinimo, [&](auto visitar)
+                                 {
+                                     for (int i = 1; i <= origem.getLinhas(); i++)
+                                     {
+                                         const Node *sentinela = origem.getSentinelaLinha(i);
+                                         for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+                                             visitar(i, no->coluna);
+                                     } });
+    }
+}
+
+MatrizDiagonal::MatrizDiagonal(const int &lin, const int &col, std::vector<int> deslocamentos)
+    : linhas(lin), colunas(col), deslocamentos(std::move(deslocamentos))
+{
+    valores.assign(this->deslocamentos.size() * static_cast<size_t>(linhas), 0.0);
+}
+
+MatrizDiagonal::MatrizDiagonal(const Matriz &origem)
+    : MatrizDiagonal(origem.getLinhas(), origem.getColunas(), diagonaisDaMatriz(origem, 0.0))
+{
+    copiar(origem);
+}
+
+void MatrizDiagonal::copiar(const Matriz &origem)
+{
+    // Dentro de uma linha, as colunas e os deslocamentos crescem juntos: basta avançar o índice da diagonal
+    for (int i = 1; i <= linhas; i++)
+    {
+        size_t d = 0;
+        const Node *sentinela = origem.getSentinelaLinha(i);
+
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+        {
+            while (deslocamentos[d] != no->coluna - i)
+                d++;
+
+            valores[d * linhas + (i - 1)] = no->valor;
+        }
+    }
+}
+
+std::optional<MatrizDiagonal> MatrizDiagonal::detectar(const Matriz &origem, const double &preenchimentoMinimo)
+{
+    std::vector<int> deslocamentos = diagonaisDaMatriz(origem, preenchimentoMinimo);
+
+    if (deslocamentos.empty())
+        return std::nullopt;
+
+    MatrizDiagonal resultado(origem.getLinhas(), origem.getColunas(), std::move(deslocamentos));
+    resultado.copiar(origem);
+
+    return resultado;
+}
+
+std::optional<MatrizDiagonal> MatrizDiagonal::detectar(const ConstrutorMatriz &construtor, const double &preenchimentoMinimo)
+{
+    const std::vector<Tripla> &entradas = construtor.getEntradas();
+
+    std::vector<int> deslocamentos = diagonaisOcupadas(construtor.getLinhas(), construtor.getColunas(), preenchimentoMinimo, [&](auto visitar)
+                                                       {
+                                                           for (const Tripla &entrada : entradas)
+                                                               visitar(entrada.linha, entrada.coluna); });
+
+    if (deslocamentos.empty())
+        return std::nullopt;
+
+    MatrizDiagonal resultado(construtor.getLinhas(), construtor.getColunas(), std::move(deslocamentos));
+
+    // Na ordem de chegada, a última ocorrência de uma posição repetida sobrescreve as anteriores
+    for (const Tripla &entrada : entradas)
+    {
+        const int d = resultado.buscarDiagonal(entrada.coluna - entrada.linha);
+        resultado.valores[static_cast<size_t>(d) * resultado.linhas + (entrada.linha - 1)] = entrada.valor;
+    }
+
+    return resultado;
+}
+
+bool MatrizDiagonal::apenasDiagonalPrincipal(const Matriz &matriz)
+{
+    for (int i = 1; i <= matriz.getLinhas(); i++)
+    {
+        const Node *sentinela = matriz.getSentinelaLinha(i);
+        const Node *primeiro = sentinela->direita;
+
+        if (primeiro != sentinela && (primeiro->coluna != i || primeiro->direita != sentinela))
+            return false;
+    }
+
+    return true;
+}
+
+int MatrizDiagonal::buscarDiagonal(const int &deslocamento) const
+{
+    auto posicao = std::lower_bound(deslocamentos.begin(), deslocamentos.end(), deslocamento);
+
+    if (posicao == deslocamentos.end() || *posicao != deslocamento)
+        return -1;
+
+    return static_cast<int>(posicao - deslocamentos.begin());
+}
+
+int MatrizDiagonal::getLinhas() const
+{
+    return linhas;
+}
+
+int MatrizDiagonal::getColunas() const
+{
+    return colunas;
+}
+
+const std::vector<int> &MatrizDiagonal::getDeslocamentos() const
+{
+    return deslocamentos;
+}
+
+size_t MatrizDiagonal::quantidade() const
+{
+    return static_cast<size_t>(std::count_if(valores.begin(), valores.end(), [](const double &valor)
+                                             { return valor != 0; }));
+}
+
+bool MatrizDiagonal::diagonalPura() const
+{
+    return deslocamentos.empty() || (deslocamentos.size() == 1 && deslocamentos[0] == 0);
+}
+
+double MatrizDiagonal::get(const int &posI, const int &posJ) const
+{
+    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
+        throw std::invalid_argument("Erro: Local de acesso inválido");
+
+    const int d = buscarDiagonal(posJ - posI);
+    return d < 0 ? 0.0 : valores[static_cast<size_t>(d) * linhas + (posI - 1)];
+}
+
+void MatrizDiagonal::multiplicar(const std::vector<double> &x, std::vector<double> &y) const
+{
+    if (x.size() != static_cast<size_t>(colunas))
+        throw std::invalid_argument("Erro: O vetor precisa ter o mesmo tamanho que o número de colunas");
+
+    y.assign(linhas, 0.0);
+
+    for (size_t d = 0; d < deslocamentos.size(); d++)
+    {
+        const int k = deslocamentos[d];
+        const double *diagonal = valores.data() + d * linhas;
+
+        for (int i = std::max(0, -k), fim = std::min(linhas, colunas - k); i < fim; i++)
+            y[i] += diagonal[i] * x[i + k];
+    }
+}
+
+Matriz MatrizDiagonal::paraMatriz() const
+{
+    ConstrutorMatriz construtor(linhas, colunas);
+    construtor.reservar(quantidade());
+
+    // Deslocamentos crescentes dão colunas crescentes: os elementos chegam em ordem e não são ordenados
+    for (int i = 0; i < linhas; i++)
+    {
+        for (size_t d = 0; d < deslocamentos.size(); d++)
+        {
+            const int j = i + deslocamentos[d];
+
+            if (j >= 0 && j < colunas)
+                construtor.adicionar(i + 1, j + 1, valores[d * linhas + i]);
+        }
+    }
+
+    return construtor.construir();
+}
+
+MatrizDiagonal sum(const MatrizDiagonal &matrizA, const MatrizDiagonal &matrizB)
+{
+    if (matrizA.linhas != matrizB.linhas || matrizA.colunas != matrizB.colunas)
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho");
+
+    std::vector<int> uniao;
+    std::set_union(matrizA.deslocamentos.begin(), matrizA.deslocamentos.end(),
+                   matrizB.deslocamentos.begin(), matrizB.deslocamentos.end(), std::back_inserter(uniao));
+
+    MatrizDiagonal resultado(matrizA.linhas, matrizA.colunas, std::move(uniao));
+    const size_t n = static_cast<size_t>(resultado.linhas);
+
+    for (const MatrizDiagonal *parcela : {&matrizA, &matrizB})
+    {
+        for (size_t d = 0; d < parcela->deslocamentos.size(); d++)
+        {
+            double *destino = resultado.valores.data() + resultado.buscarDiagonal(parcela->deslocamentos[d]) * n;
+            const double *origem = parcela->valores.data() + d * n;
+
+            for (size_t i = 0; i < n; i++)
+                destino[i] += origem[i];
+        }
+    }
+
+    return resultado;
+}
+
+MatrizDiagonal multiply(const MatrizDiagonal &matrizA, const MatrizDiagonal &matrizB)
+{
+    if (matrizA.colunas != matrizB.linhas)
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    const int linhas = matrizA.linhas, internas = matrizA.colunas, colunas = matrizB.colunas;
+
+    std::vector<int> deslocamentos;
+    for (const int &ka : matrizA.deslocamentos)
+        for (const int &kb : matrizB.deslocamentos)
+            if (ka + kb > -linhas && ka + kb < colunas)
+                deslocamentos.push_back(ka + kb);
+
+    std::sort(deslocamentos.begin(), deslocamentos.end());
+    deslocamentos.erase(std::unique(deslocamentos.begin(), deslocamentos.end()), deslocamentos.end());
+
+    MatrizDiagonal resultado(linhas, colunas, std::move(deslocamentos));
+
+    // C(i, i + ka + kb) += A(i, i + ka) * B(i + ka, i + ka + kb)
+    for (size_t a = 0; a < matrizA.deslocamentos.size(); a++)
+    {
+        const int ka = matrizA.deslocamentos[a];
+        const double *diagonalA = matrizA.valores.data() + a * linhas;
+
+        for (size_t b = 0; b < matrizB.deslocamentos.size(); b++)
+        {
+            const int kb = matrizB.deslocamentos[b];
+            const int c = resultado.buscarDiagonal(ka + kb);
+            if (c < 0)
+                continue;
+
+            const double *diagonalB = matrizB.valores.data() + b * internas;
+            double *diagonalC = resultado.valores.data() + static_cast<size_t>(c) * linhas;
+
+            const int inicio = std::max({0, -ka, -ka - kb});
+            const int fim = std::min({linhas, internas - ka, colunas - ka - kb});
+
+            for (int i = inicio; i < fim; i++)
+                diagonalC[i] += diagonalA[i] * diagonalB[i + ka];
+        }
+    }
+
+    return resultado;
+}
+
+Matriz multiply(const MatrizDiagonal &matrizA, const Matriz &matrizB)
+{
+    if (matrizA.colunas != matrizB.getLinhas())
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    if (!matrizA.diagonalPura())
+    {
+        EspacoProduto espaco;
+        return multiplicarEsparso(matrizA.paraMatriz(), matrizB, espaco);
+    }
+
+    ConstrutorMatriz construtor(matrizA.linhas, matrizB.getColunas());
+
+    if (matrizA.valores.empty())
+        return construtor.construir();
+
+    // Linha i de D * B = D(i, i) * linha i de B, já em ordem de colunas
+    for (int i = 1; i <= std::min(matrizA.linhas, matrizB.getLinhas()); i++)
+    {
+        const double escala = matrizA.valores[i - 1];
+        if (escala == 0)
+            continue;
+
+        const Node *sentinela = matrizB.getSentinelaLinha(i);
+        for (const Node *no = sentinela->direita; no != sentinela; no = no->direita)
+            construtor.adicionar(i, no->coluna, escala * no->valor);
+    }
+
+    return construtor.construir();
+}
+
+Matriz multiply(const Matriz &matrizA, const MatrizDiagonal &matrizB)
+{
+    if (matrizA.getColunas() != matrizB.linhas)
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    if (!matrizB.diagonalPura())
+    {
+        EspacoProduto espaco;
+        return multiplicarEsparso(matrizA, matrizB.paraMatriz(), espaco);
+    }
+
+    ConstrutorMatriz construtor(matrizA.getLinhas(), matrizB.colunas);
+
+    if (matrizB.valores.empty())
+        return construtor.construir();
+
+    // Coluna j de A * D = D(j, j) * coluna j de A; as colunas de cada linha continuam em ordem
+    for (int i = 1; i <= matrizA.getLinhas(); i++)
+    {
+        const Node *sentinela = matrizA.getSentinelaLinha(i);
+        for (const Node *no = sentinela->direita; no != sentinela && no->coluna <= matrizB.colunas; no = no->direita)
+            construtor.adicionar(i, no->coluna, no->valor * matrizB.valores[no->coluna - 1]);
+    }
+
+    return construtor.construir();
+}
@@ -0,0 +1,172 @@
+#include "matrizHash/MatrizHash.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <algorithm>
+
+MatrizHash::MatrizHash(const int &lin, const int &col, const size_t &capacidadeInicial)
+    : linhas(lin), colunas(col), quantidadeElementos(0)
+{
+    if (lin <= 0 || col <= 0)
+        throw std::invalid_argument("Erro: Tamanho de matriz inválido, insira valores maiores que 0");
+
+    // Capacidade em potência de 2 com folga para manter a ocupação abaixo de 70%
+    size_t capacidade = 16;
+    while (capacidade * 7 < capacidadeInicial * 10)
+        capacidade *= 2;
+
+    tabela.assign(capacidade, {0, 0.0});
+}
+
+MatrizHash::MatrizHash(const Matriz &origem) : MatrizHash(origem.getLinhas(), origem.getColunas())
+{
+    for (ConstIteratorM it = origem.begin(); it != origem.end(); ++it)
+        insert(it.linha(), it.coluna(), *it);
+}
+
+uint64_t MatrizHash::compactar(const int &posI, const int &posJ)
+{
+    return (static_cast<uint64_t>(posI) << 32) | static_cast<uint32_t>(posJ);
+}
+
+uint64_t MatrizHash::espalhar(uint64_t chave)
+{
+    // Finalizador do splitmix64: distribui bem chaves com bits altos e baixos correlacionados
+    chave ^= chave >> 30;
+    chave *= 0xbf58476d1ce4e5b9ULL;
+    chave ^= chave >> 27;
+    chave *= 0x94d049bb133111ebULL;
+    chave ^= chave >> 31;
+    return chave;
+}
+
+size_t MatrizHash::localizar(const uint64_t &chave) const
+{
+    const size_t mascara = tabela.size() - 1;
+    size_t posicao = espalhar(chave) & mascara;
+
+    while (tabela[posicao].chave != 0 && tabela[posicao].chave != chave)
+        posicao = (posicao + 1) & mascara;
+
+    return posicao;
+}
+
+void MatrizHash::redimensionar(const size_t &capacidade)
+{
+    std::vector<Entrada> antiga(capacidade, {0, 0.0});
+    antiga.swap(tabela);
+
+    for (const Entrada &entrada : antiga)
+    {
+        if (entrada.chave != 0)
+            tabela[localizar(entrada.chave)] = entrada;
+    }
+}
+
+void MatrizHash::validarPosicao(const int &posI, const int &posJ) const
+{
+    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
+        throw std::invalid_argument("Erro: Local de acesso inválido");
+}
+
+int MatrizHash::getLinhas() const
+{
+    return linhas;
+}
+
+int MatrizHash::getColunas() const
+{
+    return colunas;
+}
+
+size_t MatrizHash::quantidade() const
+{
+    return quantidadeElementos;
+}
+
+void MatrizHash::insert(const int &posI, const int &posJ, const double &value)
+{
+    if (value == 0)
+        return;
+
+    validarPosicao(posI, posJ);
+
+    const uint64_t chave = compactar(posI, posJ);
+    size_t posicao = localizar(chave);
+
+    if (tabela[posicao].chave == chave)
+    {
+        tabela[posicao].valor = value;
+        return;
+    }
+
+    if ((quantidadeElementos + 1) * 10 > tabela.size() * 7)
+    {
+        redimensionar(tabela.size() * 2);
+        posicao = localizar(chave);
+    }
+
+    tabela[posicao] = {chave, value};
+    quantidadeElementos++;
+}
+
+double MatrizHash::get(const int &posI, const int &posJ) const
+{
+    validarPosicao(posI, posJ);
+
+    const uint64_t chave = compactar(posI, posJ);
+    const Entrada &entrada = tabela[localizar(chave)];
+
+    return entrada.chave == chave ? entrada.valor : 0;
+}
+
+bool MatrizHash::erase(const int &posI, const int &posJ)
+{
+    validarPosicao(posI, posJ);
+
+    const uint64_t chave = compactar(posI, posJ);
+    size_t vazia = localizar(chave);
+
+    if (tabela[vazia].chave != chave)
+        return false;
+
+    // Backward shift: puxa para trás os elementos do agrupamento que deixariam de ser encontrados
+    const size_t mascara = tabela.size() - 1;
+    size_t atual = (vazia + 1) & mascara;
+
+    while (tabela[atual].chave != 0)
+    {
+        size_t ideal = espalhar(tabela[atual].chave) & mascara;
+
+        // O elemento só pode ocupar a posição vazia se ela estiver entre a posição ideal e a atual
+        if (((atual - ideal) & mascara) >= ((atual - vazia) & mascara))
+        {
+            tabela[vazia] = tabela[atual];
+            vazia = atual;
+        }
+
+        atual = (atual + 1) & mascara;
+    }
+
+    tabela[vazia] = {0, 0.0};
+    quantidadeElementos--;
+    return true;
+}
+
+void MatrizHash::limpar()
+{
+    std::fill(tabela.begin(), tabela.end(), Entrada{0, 0.0});
+    quantidadeElementos = 0;
+}
+
+Matriz MatrizHash::paraMatriz() const
+{
+    ConstrutorMatriz construtor(linhas, colunas);
+    construtor.reservar(quantidadeElementos);
+
+    for (const Entrada &entrada : tabela)
+    {
+        if (entrada.chave != 0)
+            construtor.adicionar(static_cast<int>(entrada.chave >> 32), static_cast<int>(entrada.chave & 0xffffffffULL), entrada.valor);
+    }
+
+    return construtor.construir();
+}
@@ -0,0 +1,371 @@
+#include "matrizHibrida/MatrizHibrida.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+/**
+ * @brief Kernel denso: C += A x B para ladrilhos contíguos de lado t.
+ *
+ * A ordem i-k-j mantém o laço interno sobre linhas contíguas de B e C.
+ */
+static void multiplicarBlocos(const double *a, const double *b, double *c, const int t)
+{
+    for (int i = 0; i < t; i++)
+    {
+        double *linhaC = c + i * t;
+        for (int k = 0; k < t; k++)
+        {
+            const double aik = a[i * t + k];
+            if (aik == 0)
+                continue;
+
+            const double *linhaB = b + k * t;
+            for (int j = 0; j < t; j++)
+                linhaC[j] += aik * linhaB[j];
+        }
+    }
+}
+
+MatrizHibrida::MatrizHibrida(const int &lin, const int &col, const int &tamanhoBloco)
+    : linhas(lin), colunas(col), tamanhoBloco(tamanhoBloco), esparsa(lin, col)
+{
+    blocosPorFaixa.resize((lin + tamanhoBloco - 1) / tamanhoBloco);
+}
+
+MatrizHibrida::MatrizHibrida(const Matriz &origem, const int &tamanhoBloco, const double &densidadeMinima)
+    : linhas(origem.getLinhas()), colunas(origem.getColunas()), tamanhoBloco(tamanhoBloco),
+      esparsa(origem.getLinhas(), origem.getColunas())
+{
+    if (tamanhoBloco <= 0)
+        throw std::invalid_argument("Erro: Tamanho de bloco inválido, insira um valor maior que 0");
+
+    const int faixasColuna = (colunas + tamanhoBloco - 1) / tamanhoBloco;
+    blocosPorFaixa.resize((linhas + tamanhoBloco - 1) / tamanhoBloco);
+
+    // Primeira passada: conta os elementos de cada ladrilho
+    std::unordered_map<long long, int> contagem;
+    for (ConstIteratorM it = origem.begin(); it != origem.end(); ++it)
+    {
+        long long chave = static_cast<long long>((it.linha() - 1) / tamanhoBloco) * faixasColuna + (it.coluna() - 1) / tamanhoBloco;
+        contagem[chave]++;
+    }
+
+    for (const auto &par : contagem)
+    {
+        int linhaBloco = static_cast<int>(par.first / faixasColuna);
+        int colunaBloco = static_cast<int>(par.first % faixasColuna);
+
+        int altura = std::min(tamanhoBloco, linhas - linhaBloco * tamanhoBloco);
+        int largura = std::min(tamanhoBloco, colunas - colunaBloco * tamanhoBloco);
+
+        if (par.second >= densidadeMinima * altura * largura)
+            adicionarBloco(linhaBloco, colunaBloco);
+    }
+
+    // Segunda passada: distribui os valores entre os ladrilhos densos e a parte esparsa, que chega
+    // em ordem de linha e é montada de uma só vez
+    ConstrutorMatriz construtor(linhas, colunas);
+
+    for (ConstIteratorM it = origem.begin(); it != origem.end(); ++it)
+    {
+        int i = it.linha() - 1, j = it.coluna() - 1;
+        int indice = buscarBloco(i / tamanhoBloco, j / tamanhoBloco);
+
+        if (indice >= 0)
+            blocos[indice].valores[(i % tamanhoBloco) * tamanhoBloco + j % tamanhoBloco] = *it;
+        else
+            construtor.adicionar(it.linha(), it.coluna(), *it);
+    }
+
+    esparsa = construtor.construir();
+}
+
+int MatrizHibrida::buscarBloco(const int &linhaBloco, const int &colunaBloco) const
+{
+    const auto &faixa = blocosPorFaixa[linhaBloco];
+    auto it = std::lower_bound(faixa.begin(), faixa.end(), std::make_pair(colunaBloco, -1));
+
+    if (it != faixa.end() && it->first == colunaBloco)
+        return it->second;
+
+    return -1;
+}
+
+int MatrizHibrida::adicionarBloco(const int &linhaBloco, const int &colunaBloco)
+{
+    int indice = static_cast<int>(blocos.size());
+    blocos.push_back({linhaBloco, colunaBloco, std::vector<double>(static_cast<size_t>(tamanhoBloco) * tamanhoBloco, 0.0)});
+
+    auto &faixa = blocosPorFaixa[linhaBloco];
+    faixa.insert(std::lower_bound(faixa.begin(), faixa.end(), std::make_pair(colunaBloco, -1)), std::make_pair(colunaBloco, indice));
+
+    return indice;
+}
+
+int MatrizHibrida::getLinhas() const
+{
+    return linhas;
+}
+
+int MatrizHibrida::getColunas() const
+{
+    return colunas;
+}
+
+int MatrizHibrida::getTamanhoBloco() const
+{
+    return tamanhoBloco;
+}
+
+size_t MatrizHibrida::quantidadeBlocos() const
+{
+    return blocos.size();
+}
+
+const Matriz &MatrizHibrida::getEsparsa() const
+{
+    return esparsa;
+}
+
+double MatrizHibrida::get(const int &posI, const int &posJ) const
+{
+    if (posI <= 0 || posI > linhas || posJ <= 0 || posJ > colunas)
+        throw std::invalid_argument("Erro: Local de acesso inválido");
+
+    int i = posI - 1, j = posJ - 1;
+    int indice = buscarBloco(i / tamanhoBloco, j / tamanhoBloco);
+
+    if (indice >= 0)
+        return blocos[indice].valores[(i % tamanhoBloco) * tamanhoBloco + j % tamanhoBloco];
+
+    return esparsa.get(posI, posJ);
+}
+
+Matriz MatrizHibrida::paraMatriz() const
+{
+    ConstrutorMatriz construtor(linhas, colunas);
+
+    // Cada linha intercala a parte esparsa com as linhas dos ladrilhos da faixa (em ordem de
+    // coluna e sem sobreposição), o que entrega os elementos ao construtor já ordenados
+    for (int linha = 1; linha <= linhas; linha++)
+    {
+        const int i = (linha - 1) % tamanhoBloco;
+        const Node *sentinela = esparsa.getSentinelaLinha(linha);
+        const Node *no = sentinela->direita;
+
+        for (const auto &par : blocosPorFaixa[(linha - 1) / tamanhoBloco])
+        {
+            const int primeiraColuna = par.first * tamanhoBloco + 1;
+            for (; no != sentinela && no->coluna < primeiraColuna; no = no->direita)
+                construtor.adicionar(linha, no->coluna, no->valor);
+
+            const double *valores = blocos[par.second].valores.data() + i * tamanhoBloco;
+            for (int j = 0; j < tamanhoBloco && primeiraColuna + j <= colunas; j++)
+                construtor.adicionar(linha, primeiraColuna + j, valores[j]);
+        }
+
+        for (; no != sentinela; no = no->direita)
+            construtor.adicionar(linha, no->coluna, no->valor);
+    }
+
+    return construtor.construir();
+}
+
+MatrizHibrida sum(const MatrizHibrida &matrizA, const MatrizHibrida &matrizB)
+{
+    if (matrizA.linhas != matrizB.linhas || matrizA.colunas != matrizB.colunas)
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho");
+
+    if (matrizA.tamanhoBloco != matrizB.tamanhoBloco)
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho de bloco");
+
+    const int t = matrizA.tamanhoBloco;
+    MatrizHibrida matriz(matrizA.linhas, matrizA.colunas, t);
+
+    // Ladrilhos densos: cópia de A e soma contígua com B
+    for (const BlocoDenso &bloco : matrizA.blocos)
+    {
+        int indice = matriz.adicionarBloco(bloco.linhaBloco, bloco.colunaBloco);
+        matriz.blocos[indice].valores = bloco.valores;
+    }
+
+    for (const BlocoDenso &bloco : matrizB.blocos)
+    {
+        int indice = matriz.buscarBloco(bloco.linhaBloco, bloco.colunaBloco);
+        if (indice < 0)
+        {
+            indice = matriz.adicionarBloco(bloco.linhaBloco, bloco.colunaBloco);
+            matriz.blocos[indice].valores = bloco.valores;
+            continue;
+        }
+
+        std::vector<double> &destino = matriz.blocos[indice].valores;
+        for (size_t k = 0; k < destino.size(); k++)
+            destino[k] += bloco.valores[k];
+    }
+
+    // Partes esparsas: intercala as duas linhas em ordem de coluna; o resultado chega ao construtor ordenado
+    ConstrutorMatriz construtor(matriz.linhas, matriz.colunas);
+
+    for (int i = 1; i <= matriz.linhas; i++)
+    {
+        const Node *sentinelaA = matrizA.esparsa.getSentinelaLinha(i);
+        const Node *sentinelaB = matrizB.esparsa.getSentinelaLinha(i);
+        const Node *a = sentinelaA->direita;
+        const Node *b = sentinelaB->direita;
+
+        while (a != sentinelaA || b != sentinelaB)
+        {
+            int j;
+            double valor;
+
+            if (b == sentinelaB || (a != sentinelaA && a->coluna < b->coluna))
+            {
+                j = a->coluna;
+                valor = a->valor;
+                a = a->direita;
+            }
+            else if (a == sentinelaA || b->coluna < a->coluna)
+            {
+                j = b->coluna;
+                valor = b->valor;
+                b = b->direita;
+            }
+            else
+            {
+                j = a->coluna;
+                valor = a->valor + b->valor;
+                a = a->direita;
+                b = b->direita;
+            }
+
+            int indice = matriz.buscarBloco((i - 1) / t, (j - 1) / t);
+            if (indice >= 0)
+                matriz.blocos[indice].valores[((i - 1) % t) * t + (j - 1) % t] += valor;
+            else
+                construtor.adicionar(i, j, valor);
+        }
+    }
+
+    matriz.esparsa = construtor.construir();
+    return matriz;
+}
+
+MatrizHibrida multiply(const MatrizHibrida &matrizA, const MatrizHibrida &matrizB)
+{
+    if (matrizA.colunas != matrizB.linhas)
+        throw std::invalid_argument("Erro: A matriz A precisa possui o número de colunas iguais ao número de linhas");
+
+    if (matrizA.tamanhoBloco != matrizB.tamanhoBloco)
+        throw std::invalid_argument("Erro: As matrizes não possuem o mesmo tamanho de bloco");
+
+    const int t = matrizA.tamanhoBloco;
+    MatrizHibrida matriz(matrizA.linhas, matrizB.colunas, t);
+
+    // Produtos ladrilho x ladrilho pelo kernel denso
+    for (const BlocoDenso &blocoA : matrizA.blocos)
+    {
+        for (const auto &par : matrizB.blocosPorFaixa[blocoA.colunaBloco])
+        {
+            int indice = matriz.buscarBloco(blocoA.linhaBloco, par.first);
+            if (indice < 0)
+                indice = matriz.adicionarBloco(blocoA.linhaBloco, par.first);
+
+            multiplicarBlocos(blocoA.valores.data(), matrizB.blocos[par.second].valores.data(),
+                              matriz.blocos[indice].valores.data(), t);
+        }
+    }
+
+    // Termos com parte esparsa: acumulador denso por linha de A
+    struct Termo
+    {
+        int k;
+        double valor;
+        bool denso;
+    };
+
+    std::vector<double> acumulador(matrizB.colunas + 1, 0.0);
+    std::vector<char> marcado(matrizB.colunas + 1, 0);
+    std::vector<int> tocadas;
+    std::vector<Termo> linhaA;
+
+    // Linhas em ordem crescente e colunas ordenadas: a parte esparsa é montada sem ordenação
+    ConstrutorMatriz construtor(matriz.linhas, matriz.colunas);
+
+    auto acumular = [&](const int &j, const double &valor)
+    {
+        if (!marcado[j])
+        {
+            marcado[j] = 1;
+            tocadas.push_back(j);
+        }
+        acumulador[j] += valor;
+    };
+
+    for (int i = 1; i <= matrizA.linhas; i++)
+    {
+        linhaA.clear();
+
+        for (const auto &par : matrizA.blocosPorFaixa[(i - 1) / t])
+        {
+            const double *valores = matrizA.blocos[par.second].valores.data() + ((i - 1) % t) * t;
+            for (int c = 0; c < t; c++)
+            {
+                int k = par.first * t + c + 1;
+                if (k > matrizA.colunas)
+                    break;
+                if (valores[c] != 0)
+                    linhaA.push_back({k, valores[c], true});
+            }
+        }
+
+        const Node *sentinelaA = matrizA.esparsa.getSentinelaLinha(i);
+        for (const Node *a = sentinelaA->direita; a != sentinelaA; a = a->direita)
+            linhaA.push_back({a->coluna, a->valor, false});
+
+        if (linhaA.empty())
+            continue;
+
+        for (const Termo &termo : linhaA)
+        {
+            // Denso x denso já foi resolvido pelo kernel
+            if (!termo.denso)
+            {
+                for (const auto &par : matrizB.blocosPorFaixa[(termo.k - 1) / t])
+                {
+                    const double *valores = matrizB.blocos[par.second].valores.data() + ((termo.k - 1) % t) * t;
+                    for (int c = 0; c < t; c++)
+                    {
+                        int j = par.first * t + c + 1;
+                        if (j > matrizB.colunas)
+                            break;
+                        if (valores[c] != 0)
+                            acumular(j, termo.valor * valores[c]);
+                    }
+                }
+            }
+
+            const Node *sentinelaB = matrizB.esparsa.getSentinelaLinha(termo.k);
+            for (const Node *b = sentinelaB->direita; b != sentinelaB; b = b->direita)
+                acumular(b->coluna, termo.valor * b->valor);
+        }
+
+        std::sort(tocadas.begin(), tocadas.end());
+        for (int j : tocadas)
+        {
+            double valor = acumulador[j];
+            acumulador[j] = 0;
+            marcado[j] = 0;
+
+            int indice = matriz.buscarBloco((i - 1) / t, (j - 1) / t);
+            if (indice >= 0)
+                matriz.blocos[indice].valores[((i - 1) % t) * t + (j - 1) % t] += valor;
+            else
+                construtor.adicionar(i, j, valor);
+        }
+        tocadas.clear();
+    }
+
+    matriz.esparsa = construtor.construir();
+    return matriz;
+}
@@ -0,0 +1,99 @@
+#include "registro/CacheResultados.hpp"
+#include "utils/utils.hpp"
+
+size_t CacheResultados::HashChave::operator()(const Chave &chave) const
+{
+    // Combinação no estilo de boost::hash_combine
+    size_t hash = std::hash<int>()(static_cast<int>(chave.operacao));
+    for (const uint64_t &valor : {chave.identidadeA, chave.versaoA, chave.identidadeB, chave.versaoB})
+        hash ^= std::hash<uint64_t>()(valor) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+
+    return hash;
+}
+
+CacheResultados::CacheResultados(const size_t &capacidade, const size_t &limiteBytes)
+    : capacidade(capacidade), limiteBytes(limiteBytes)
+{
+}
+
+Matriz CacheResultados::buscarOuCalcular(const Chave &chave, const std::function<Matriz()> &calcular)
+{
+    auto it = indice.find(chave);
+    if (it != indice.end())
+    {
+        acertos++;
+        resultados.splice(resultados.begin(), resultados, it->second);
+        return it->second->resultado;
+    }
+
+    faltas++;
+    Matriz resultado = calcular();
+
+    const size_t tamanho = resultado.memoryUsage();
+    if (capacidade == 0 || (limiteBytes != 0 && tamanho > limiteBytes))
+        return resultado;
+
+    resultados.push_front({chave, resultado, tamanho});
+    indice[chave] = resultados.begin();
+    bytes += tamanho;
+
+    while (resultados.size() > capacidade || (limiteBytes != 0 && bytes > limiteBytes))
+    {
+        bytes -= resultados.back().bytes;
+        indice.erase(resultados.back().chave);
+        resultados.pop_back();
+    }
+
+    return resultado;
+}
+
+Matriz CacheResultados::somar(const Matriz &matrizA, const Matriz &matrizB)
+{
+    const Chave chave{OperacaoCache::Soma, matrizA.getIdentidade(), matrizA.getVersao(), matrizB.getIdentidade(), matrizB.getVersao()};
+    return buscarOuCalcular(chave, [&]()
+                            { return sum(matrizA, matrizB); });
+}
+
+Matriz CacheResultados::multiplicar(const Matriz &matrizA, const Matriz &matrizB)
+{
+    const Chave chave{OperacaoCache::Multiplicacao, matrizA.getIdentidade(), matrizA.getVersao(), matrizB.getIdentidade(), matrizB.getVersao()};
+    return buscarOuCalcular(chave, [&]()
+                            { return multiply(matrizA, matrizB); });
+}
+
+void CacheResultados::limpar()
+{
+    resultados.clear();
+    indice.clear();
+    bytes = 0;
+}
+
+size_t CacheResultados::size() const
+{
+    return resultados.size();
+}
+
+size_t CacheResultados::getCapacidade() const
+{
+    return capacidade;
+}
+
+size_t CacheResultados::getLimiteBytes() const
+{
+    return limiteBytes;
+}
+
+size_t CacheResultados::getBytes() const
+{
+    return bytes;
+}
+
+size_t CacheResultados::getAcertos() const
+{
+    return acertos;
+}
+
+size_t CacheResultados::getFaltas() const
+{
+    return faltas;
+}
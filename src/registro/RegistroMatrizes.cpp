@@ -0,0 +1,209 @@
+#include "registro/RegistroMatrizes.hpp"
+#include "io/MatrizIO.hpp"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <system_error>
+
+RegistroMatrizes::RegistroMatrizes(const size_t &orcamentoBytes, const std::filesystem::path &base)
+    : orcamento(orcamentoBytes)
+{
+    // Nome exclusivo: vários registros (e vários processos) podem usar a mesma base
+    const auto marca = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::error_code erro;
+
+    for (int tentativa = 0; tentativa < 100; tentativa++)
+    {
+        diretorio = base / ("matriz-registro-" + std::to_string(marca) + "-" + std::to_string(tentativa));
+
+        if (std::filesystem::create_directories(diretorio, erro))
+            return;
+    }
+
+    throw std::runtime_error("Erro: Não foi possível criar o diretório de instantâneos em " + base.string());
+}
+
+RegistroMatrizes::~RegistroMatrizes()
+{
+    std::error_code erro;
+    std::filesystem::remove_all(diretorio, erro);
+}
+
+void RegistroMatrizes::carregarEntrada(const std::string &nome, Entrada &entrada, const Matriz &matriz)
+{
+    entrada.matriz = matriz;
+    entrada.linhas = matriz.getLinhas();
+    entrada.colunas = matriz.getColunas();
+    entrada.quantidade = matriz.quantidade();
+    entrada.bytes = matriz.memoryUsage();
+
+    usoRecente.push_front(nome);
+    entrada.uso = usoRecente.begin();
+
+    estatisticas.bytesEmMemoria += entrada.bytes;
+    estatisticas.emMemoria++;
+}
+
+void RegistroMatrizes::despejar(Entrada &entrada)
+{
+    if (!entrada.instantaneoValido)
+    {
+        if (entrada.arquivo.empty())
+            entrada.arquivo = diretorio / ("matriz-" + std::to_string(proximoArquivo++) + ".bin");
+
+        escreverMatrizBinaria(*entrada.matriz, entrada.arquivo.string());
+        entrada.instantaneoValido = true;
+        estatisticas.gravacoes++;
+    }
+
+    entrada.matriz.reset();
+    usoRecente.erase(entrada.uso);
+
+    estatisticas.bytesEmMemoria -= entrada.bytes;
+    estatisticas.emMemoria--;
+    estatisticas.emDisco++;
+    estatisticas.despejos++;
+}
+
+void RegistroMatrizes::respeitarOrcamento()
+{
+    while (orcamento != 0 && estatisticas.bytesEmMemoria > orcamento && usoRecente.size() > 1)
+        despejar(entradas.at(usoRecente.back()));
+}
+
+void RegistroMatrizes::descartarInstantaneo(Entrada &entrada)
+{
+    if (!entrada.arquivo.empty())
+    {
+        std::error_code erro;
+        std::filesystem::remove(entrada.arquivo, erro);
+        entrada.arquivo.clear();
+    }
+
+    entrada.instantaneoValido = false;
+}
+
+bool RegistroMatrizes::contem(const std::string &nome) const
+{
+    return entradas.find(nome) != entradas.end();
+}
+
+bool RegistroMatrizes::inserir(const std::string &nome, const Matriz &matriz)
+{
+    if (contem(nome))
+        return false;
+
+    carregarEntrada(nome, entradas[nome], matriz);
+    respeitarOrcamento();
+    return true;
+}
+
+void RegistroMatrizes::definir(const std::string &nome, const Matriz &matriz)
+{
+    remover(nome);
+    inserir(nome, matriz);
+}
+
+Matriz RegistroMatrizes::obter(const std::string &nome)
+{
+    auto it = entradas.find(nome);
+    if (it == entradas.end())
+        throw std::invalid_argument("Erro: Matriz \"" + nome + "\" não definida");
+
+    Entrada &entrada = it->second;
+
+    if (entrada.matriz)
+    {
+        estatisticas.acertos++;
+        usoRecente.splice(usoRecente.begin(), usoRecente, entrada.uso);
+        return *entrada.matriz;
+    }
+
+    Matriz matriz = lerMatrizBinaria(entrada.arquivo.string());
+
+    estatisticas.faltas++;
+    estatisticas.emDisco--;
+    carregarEntrada(nome, entrada, matriz);
+    respeitarOrcamento();
+
+    return matriz;
+}
+
+bool RegistroMatrizes::remover(const std::string &nome)
+{
+    auto it = entradas.find(nome);
+    if (it == entradas.end())
+        return false;
+
+    Entrada &entrada = it->second;
+
+    if (entrada.matriz)
+    {
+        usoRecente.erase(entrada.uso);
+        estatisticas.bytesEmMemoria -= entrada.bytes;
+        estatisticas.emMemoria--;
+    }
+    else
+    {
+        estatisticas.emDisco--;
+    }
+
+    descartarInstantaneo(entrada);
+    entradas.erase(it);
+    return true;
+}
+
+InfoRegistro RegistroMatrizes::resumo(const std::string &nome) const
+{
+    auto it = entradas.find(nome);
+    if (it == entradas.end())
+        throw std::invalid_argument("Erro: Matriz \"" + nome + "\" não definida");
+
+    const Entrada &entrada = it->second;
+    return {nome, entrada.linhas, entrada.colunas, entrada.quantidade, entrada.bytes, entrada.matriz.has_value()};
+}
+
+std::vector<InfoRegistro> RegistroMatrizes::listar() const
+{
+    std::vector<InfoRegistro> lista;
+    lista.reserve(entradas.size());
+
+    for (const auto &par : entradas)
+        lista.push_back(resumo(par.first));
+
+    std::sort(lista.begin(), lista.end(), [](const InfoRegistro &a, const InfoRegistro &b)
+              { return a.nome < b.nome; });
+
+    return lista;
+}
+
+size_t RegistroMatrizes::size() const
+{
+    return entradas.size();
+}
+
+bool RegistroMatrizes::empty() const
+{
+    return entradas.empty();
+}
+
+const EstatisticasRegistro &RegistroMatrizes::getEstatisticas() const
+{
+    return estatisticas;
+}
+
+size_t RegistroMatrizes::getOrcamento() const
+{
+    return orcamento;
+}
+
+void RegistroMatrizes::setOrcamento(const size_t &orcamentoBytes)
+{
+    orcamento = orcamentoBytes;
+    respeitarOrcamento();
+}
+
+const std::filesystem::path &RegistroMatrizes::getDiretorio() const
+{
+    return diretorio;
+}
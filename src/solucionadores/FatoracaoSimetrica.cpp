@@ -0,0 +1,313 @@
+#include "solucionadores/FatoracaoSimetrica.hpp"
+#include "matrizCSR/MatrizCSR.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+
+namespace
+{
+    /**
+     * @brief Verifica se o padrão e os valores da MatrizCSR são simétricos.
+     *
+     * Como as colunas de cada linha estão ordenadas, o par de (i, j) é encontrado por busca binária na linha j.
+     */
+    bool simetrica(const MatrizCSR &matriz)
+    {
+        const std::vector<size_t> &inicio = matriz.getInicioLinha();
+        const std::vector<int> &colunas = matriz.getIndicesColuna();
+        const std::vector<double> &valores = matriz.getValores();
+
+        for (int i = 0; i < matriz.getLinhas(); i++)
+        {
+            for (size_t p = inicio[i]; p < inicio[i + 1]; p++)
+            {
+                const int j = colunas[p];
+                if (j <= i)
+                    continue;
+
+                auto primeiro = colunas.begin() + inicio[j], ultimo = colunas.begin() + inicio[j + 1];
+                auto par = std::lower_bound(primeiro, ultimo, i);
+
+                if (par == ultimo || *par != i || valores[par - colunas.begin()] != valores[p])
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Ordenação de mínimo grau sobre o grafo de eliminação.
+     *
+     * A cada passo elimina o vértice de menor grau (empates pelo menor índice) e liga todos os seus
+     * vizinhos entre si, como a eliminação faria no fator. A fila de prioridade é atualizada de forma
+     * preguiçosa: entradas cujo grau já mudou são descartadas ao sair da fila.
+     */
+    std::vector<int> ordenarMinimoGrau(const MatrizCSR &matriz)
+    {
+        const int n = matriz.getLinhas();
+        const std::vector<size_t> &inicio = matriz.getInicioLinha();
+        const std::vector<int> &colunas = matriz.getIndicesColuna();
+
+        std::vector<std::vector<int>> vizinhos(n);
+        for (int i = 0; i < n; i++)
+            for (size_t p = inicio[i]; p < inicio[i + 1]; p++)
+                if (colunas[p] != i)
+                    vizinhos[i].push_back(colunas[p]);
+
+        using Entrada = std::pair<size_t, int>;
+        std::priority_queue<Entrada, std::vector<Entrada>, std::greater<Entrada>> fila;
+        for (int i = 0; i < n; i++)
+            fila.push({vizinhos[i].size(), i});
+
+        std::vector<bool> eliminado(n, false);
+        std::vector<int> ordem, uniao;
+        ordem.reserve(n);
+
+        while (!fila.empty())
+        {
+            const auto [grau, v] = fila.top();
+            fila.pop();
+
+            if (eliminado[v] || grau != vizinhos[v].size())
+                continue;
+
+            eliminado[v] = true;
+            ordem.push_back(v);
+
+            const std::vector<int> &clique = vizinhos[v];
+            for (const int &u : clique)
+            {
+                // vizinhos[u] ∪ clique, sem u e sem v (as listas estão ordenadas)
+                uniao.clear();
+                std::set_union(vizinhos[u].begin(), vizinhos[u].end(), clique.begin(), clique.end(), std::back_inserter(uniao));
+                uniao.erase(std::remove_if(uniao.begin(), uniao.end(), [&](const int &w)
+                                           { return w == u || w == v; }),
+                            uniao.end());
+
+                vizinhos[u].swap(uniao);
+                fila.push({vizinhos[u].size(), u});
+            }
+
+            std::vector<int>().swap(vizinhos[v]);
+        }
+
+        return ordem;
+    }
+}
+
+FatoracaoSimetrica::FatoracaoSimetrica(const Matriz &matriz, const TipoFatoracao &tipo, const OrdenacaoFatoracao &ordenacao)
+    : n(matriz.getLinhas()), tipo(tipo)
+{
+    if (matriz.getLinhas() != matriz.getColunas())
+        throw std::invalid_argument("Erro: A fatoração exige uma matriz quadrada");
+
+    const MatrizCSR csr(matriz);
+
+    if (!simetrica(csr))
+        throw std::invalid_argument("Erro: A fatoração exige uma matriz simétrica");
+
+    inicioA = csr.getInicioLinha();
+    colunasA = csr.getIndicesColuna();
+
+    if (ordenacao == OrdenacaoFatoracao::MinimoGrau)
+    {
+        permutacao = ordenarMinimoGrau(csr);
+    }
+    else
+    {
+        permutacao.resize(n);
+        for (int k = 0; k < n; k++)
+            permutacao[k] = k;
+    }
+
+    inversa.resize(n);
+    for (int k = 0; k < n; k++)
+        inversa[permutacao[k]] = k;
+
+    // Análise simbólica: a linha k de L alcança, a partir de cada A(i, k) com i < k, o caminho de i até k
+    // na árvore de eliminação; cada vértice do caminho ganha um elemento na sua coluna
+    pai.assign(n, -1);
+    std::vector<int> marca(n), quantidadeColuna(n, 0);
+
+    for (int k = 0; k < n; k++)
+    {
+        marca[k] = k;
+        const int original = permutacao[k];
+
+        // Pela simetria, a linha original é também a coluna original
+        for (size_t p = inicioA[original]; p < inicioA[original + 1]; p++)
+        {
+            for (int i = inversa[colunasA[p]]; i < k && marca[i] != k; i = pai[i])
+            {
+                if (pai[i] == -1)
+                    pai[i] = k;
+
+                quantidadeColuna[i]++;
+                marca[i] = k;
+            }
+        }
+    }
+
+    inicioColuna.assign(n + 1, 0);
+    for (int j = 0; j < n; j++)
+        inicioColuna[j + 1] = inicioColuna[j] + quantidadeColuna[j];
+
+    indicesLinha.resize(inicioColuna[n]);
+    valoresL.resize(inicioColuna[n]);
+    d.resize(n);
+
+    fatorarNumerico(csr.getValores());
+}
+
+void FatoracaoSimetrica::fatorarNumerico(const std::vector<double> &valoresA)
+{
+    std::vector<double> y(n, 0.0);
+    std::vector<int> marca(n), preenchidos(n, 0), caminho(n);
+
+    for (int k = 0; k < n; k++)
+    {
+        // Padrão da linha k de L, em ordem topológica, em caminho[topo..n)
+        int topo = n;
+        marca[k] = k;
+
+        const int original = permutacao[k];
+        for (size_t p = inicioA[original]; p < inicioA[original + 1]; p++)
+        {
+            int i = inversa[colunasA[p]];
+            if (i > k)
+                continue;
+
+            y[i] += valoresA[p];
+
+            int tamanho = 0;
+            for (; marca[i] != k; i = pai[i])
+            {
+                caminho[tamanho++] = i;
+                marca[i] = k;
+            }
+
+            while (tamanho > 0)
+                caminho[--topo] = caminho[--tamanho];
+        }
+
+        // Resolve L(0:k, 0:k) y = A(0:k, k) e obtém a linha k de L e o pivô D(k)
+        d[k] = y[k];
+        y[k] = 0.0;
+
+        for (; topo < n; topo++)
+        {
+            const int i = caminho[topo];
+            const double yi = y[i];
+            y[i] = 0.0;
+
+            const size_t fim = inicioColuna[i] + preenchidos[i];
+            for (size_t p = inicioColuna[i]; p < fim; p++)
+                y[indicesLinha[p]] -= valoresL[p] * yi;
+
+            const double lki = yi / d[i];
+            d[k] -= lki * yi;
+
+            indicesLinha[fim] = k;
+            valoresL[fim] = lki;
+            preenchidos[i]++;
+        }
+
+        if (d[k] == 0 || (tipo == TipoFatoracao::Cholesky && d[k] < 0))
+        {
+            throw std::invalid_argument("Erro: Pivô " + std::string(d[k] == 0 ? "nulo" : "negativo") + " na linha " +
+                                        std::to_string(permutacao[k] + 1) +
+                                        (tipo == TipoFatoracao::Cholesky ? " (a matriz não é definida positiva)" : ""));
+        }
+    }
+}
+
+void FatoracaoSimetrica::refatorar(const Matriz &matriz)
+{
+    if (matriz.getLinhas() != n || matriz.getColunas() != n)
+        throw std::invalid_argument("Erro: As dimensões da matriz mudaram desde a análise simbólica");
+
+    const MatrizCSR csr(matriz);
+
+    if (csr.getInicioLinha() != inicioA || csr.getIndicesColuna() != colunasA)
+        throw std::invalid_argument("Erro: O padrão da matriz mudou desde a análise simbólica");
+
+    if (!simetrica(csr))
+        throw std::invalid_argument("Erro: A fatoração exige uma matriz simétrica");
+
+    fatorarNumerico(csr.getValores());
+}
+
+std::vector<double> FatoracaoSimetrica::resolver(const std::vector<double> &b) const
+{
+    if (b.size() != static_cast<size_t>(n))
+        throw std::invalid_argument("Erro: O vetor b precisa ter o mesmo tamanho que a ordem da matriz");
+
+    std::vector<double> y(n);
+    for (int k = 0; k < n; k++)
+        y[k] = b[permutacao[k]];
+
+    // L y = P b
+    for (int j = 0; j < n; j++)
+        for (size_t p = inicioColuna[j]; p < inicioColuna[j + 1]; p++)
+            y[indicesLinha[p]] -= valoresL[p] * y[j];
+
+    // D z = y
+    for (int j = 0; j < n; j++)
+        y[j] /= d[j];
+
+    // Lᵀ w = z
+    for (int j = n - 1; j >= 0; j--)
+        for (size_t p = inicioColuna[j]; p < inicioColuna[j + 1]; p++)
+            y[j] -= valoresL[p] * y[indicesLinha[p]];
+
+    std::vector<double> x(n);
+    for (int k = 0; k < n; k++)
+        x[permutacao[k]] = y[k];
+
+    return x;
+}
+
+Matriz FatoracaoSimetrica::fator() const
+{
+    ConstrutorMatriz construtor(n, n);
+    construtor.reservar(n + valoresL.size());
+
+    for (int j = 0; j < n; j++)
+    {
+        const double escala = tipo == TipoFatoracao::Cholesky ? std::sqrt(d[j]) : 1.0;
+
+        construtor.adicionar(j + 1, j + 1, escala);
+        for (size_t p = inicioColuna[j]; p < inicioColuna[j + 1]; p++)
+            construtor.adicionar(indicesLinha[p] + 1, j + 1, valoresL[p] * escala);
+    }
+
+    return construtor.construir();
+}
+
+int FatoracaoSimetrica::getOrdem() const
+{
+    return n;
+}
+
+size_t FatoracaoSimetrica::quantidadeFator() const
+{
+    return valoresL.size();
+}
+
+const std::vector<int> &FatoracaoSimetrica::getPermutacao() const
+{
+    return permutacao;
+}
+
+const std::vector<int> &FatoracaoSimetrica::getArvoreEliminacao() const
+{
+    return pai;
+}
+
+const std::vector<double> &FatoracaoSimetrica::getDiagonal() const
+{
+    return d;
+}
@@ -0,0 +1,232 @@
+#include "solucionadores/Solucionadores.hpp"
+#include "matrizCSR/MatrizCSR.hpp"
+#include <cmath>
+
+namespace
+{
+    double produtoInterno(const std::vector<double> &a, const std::vector<double> &b)
+    {
+        double soma = 0.0;
+
+        for (size_t i = 0; i < a.size(); i++)
+            soma += a[i] * b[i];
+
+        return soma;
+    }
+
+    double norma(const std::vector<double> &v)
+    {
+        return std::sqrt(produtoInterno(v, v));
+    }
+
+    /**
+     * @brief Valida as dimensões e devolve a aproximação inicial (x0 ou o vetor nulo).
+     */
+    std::vector<double> prepararInicial(const Matriz &matriz, const std::vector<double> &b, const std::vector<double> &x0)
+    {
+        if (matriz.getLinhas() != matriz.getColunas())
+            throw std::invalid_argument("Erro: O sistema exige uma matriz quadrada");
+
+        const size_t n = static_cast<size_t>(matriz.getLinhas());
+
+        if (b.size() != n)
+            throw std::invalid_argument("Erro: O vetor b precisa ter o mesmo tamanho que o número de linhas");
+
+        if (!x0.empty() && x0.size() != n)
+            throw std::invalid_argument("Erro: A aproximação inicial precisa ter o mesmo tamanho que o número de linhas");
+
+        return x0.empty() ? std::vector<double>(n, 0.0) : x0;
+    }
+
+    /**
+     * @brief Retorna a diagonal da matriz, exigindo que não haja zeros.
+     */
+    std::vector<double> diagonalSemZeros(const MatrizCSR &matriz)
+    {
+        std::vector<double> diagonal = matriz.diagonal();
+
+        for (const double &valor : diagonal)
+            if (valor == 0)
+                throw std::invalid_argument("Erro: A matriz possui zero na diagonal");
+
+        return diagonal;
+    }
+
+    /**
+     * @brief Calcula r = b - A x e retorna ||r|| / ||b||.
+     */
+    double residuoRelativo(const MatrizCSR &matriz, const std::vector<double> &b, const std::vector<double> &x,
+                           std::vector<double> &r, const double &normaB, const unsigned &threads)
+    {
+        matriz.multiplicar(x, r, threads);
+
+        for (size_t i = 0; i < r.size(); i++)
+            r[i] = b[i] - r[i];
+
+        return norma(r) / normaB;
+    }
+
+    /**
+     * @brief Trata o caso b = 0, cuja solução é o vetor nulo.
+     *
+     * @return true se b for nulo (e \p resultado já estiver preenchido).
+     */
+    bool ladoDireitoNulo(const double &normaB, ResultadoSolucionador &resultado)
+    {
+        if (normaB != 0)
+            return false;
+
+        std::fill(resultado.x.begin(), resultado.x.end(), 0.0);
+        resultado.convergiu = true;
+        resultado.residuo = 0.0;
+        resultado.historico.push_back(0.0);
+        return true;
+    }
+}
+
+ResultadoSolucionador gradienteConjugado(const Matriz &matriz, const std::vector<double> &b,
+                                         const OpcoesSolucionador &opcoes, const std::vector<double> &x0)
+{
+    ResultadoSolucionador resultado;
+    resultado.x = prepararInicial(matriz, b, x0);
+
+    const MatrizCSR A(matriz);
+    const size_t n = b.size();
+    const double normaB = norma(b);
+
+    if (ladoDireitoNulo(normaB, resultado))
+        return resultado;
+
+    std::vector<double> inversoDiagonal(n, 1.0);
+    if (opcoes.precondicionar)
+    {
+        std::vector<double> diagonal = A.diagonal();
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if (diagonal[i] <= 0)
+                throw std::invalid_argument("Erro: O precondicionador de Jacobi exige diagonal positiva");
+
+            inversoDiagonal[i] = 1.0 / diagonal[i];
+        }
+    }
+
+    std::vector<double> r(n), z(n), p(n), Ap(n);
+
+    resultado.residuo = residuoRelativo(A, b, resultado.x, r, normaB, opcoes.threads);
+    resultado.historico.push_back(resultado.residuo);
+
+    for (size_t i = 0; i < n; i++)
+        p[i] = z[i] = inversoDiagonal[i] * r[i];
+
+    double rz = produtoInterno(r, z);
+
+    while (resultado.residuo > opcoes.tolerancia && resultado.iteracoes < opcoes.maxIteracoes)
+    {
+        A.multiplicar(p, Ap, opcoes.threads);
+
+        const double pAp = produtoInterno(p, Ap);
+        if (pAp <= 0) // A matriz não é definida positiva
+            break;
+
+        const double alfa = rz / pAp;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            resultado.x[i] += alfa * p[i];
+            r[i] -= alfa * Ap[i];
+        }
+
+        resultado.iteracoes++;
+        resultado.residuo = norma(r) / normaB;
+        resultado.historico.push_back(resultado.residuo);
+
+        for (size_t i = 0; i < n; i++)
+            z[i] = inversoDiagonal[i] * r[i];
+
+        const double rzNovo = produtoInterno(r, z);
+        const double beta = rzNovo / rz;
+        rz = rzNovo;
+
+        for (size_t i = 0; i < n; i++)
+            p[i] = z[i] + beta * p[i];
+    }
+
+    resultado.convergiu = resultado.residuo <= opcoes.tolerancia;
+    return resultado;
+}
+
+ResultadoSolucionador jacobi(const Matriz &matriz, const std::vector<double> &b,
+                             const OpcoesSolucionador &opcoes, const std::vector<double> &x0)
+{
+    ResultadoSolucionador resultado;
+    resultado.x = prepararInicial(matriz, b, x0);
+
+    const MatrizCSR A(matriz);
+    const std::vector<double> diagonal = diagonalSemZeros(A);
+    const double normaB = norma(b);
+
+    if (ladoDireitoNulo(normaB, resultado))
+        return resultado;
+
+    std::vector<double> r(b.size());
+
+    resultado.residuo = residuoRelativo(A, b, resultado.x, r, normaB, opcoes.threads);
+    resultado.historico.push_back(resultado.residuo);
+
+    while (resultado.residuo > opcoes.tolerancia && resultado.iteracoes < opcoes.maxIteracoes)
+    {
+        for (size_t i = 0; i < r.size(); i++)
+            resultado.x[i] += r[i] / diagonal[i];
+
+        resultado.iteracoes++;
+        resultado.residuo = residuoRelativo(A, b, resultado.x, r, normaB, opcoes.threads);
+        resultado.historico.push_back(resultado.residuo);
+    }
+
+    resultado.convergiu = resultado.residuo <= opcoes.tolerancia;
+    return resultado;
+}
+
+ResultadoSolucionador gaussSeidel(const Matriz &matriz, const std::vector<double> &b,
+                                  const OpcoesSolucionador &opcoes, const std::vector<double> &x0)
+{
+    ResultadoSolucionador resultado;
+    resultado.x = prepararInicial(matriz, b, x0);
+
+    const MatrizCSR A(matriz);
+    const std::vector<double> diagonal = diagonalSemZeros(A);
+    const double normaB = norma(b);
+
+    if (ladoDireitoNulo(normaB, resultado))
+        return resultado;
+
+    const std::vector<size_t> &inicioLinha = A.getInicioLinha();
+    const std::vector<int> &indicesColuna = A.getIndicesColuna();
+    const std::vector<double> &valores = A.getValores();
+    std::vector<double> r(b.size());
+
+    resultado.residuo = residuoRelativo(A, b, resultado.x, r, normaB, opcoes.threads);
+    resultado.historico.push_back(resultado.residuo);
+
+    while (resultado.residuo > opcoes.tolerancia && resultado.iteracoes < opcoes.maxIteracoes)
+    {
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            double soma = b[i];
+
+            for (size_t p = inicioLinha[i]; p < inicioLinha[i + 1]; p++)
+                if (static_cast<size_t>(indicesColuna[p]) != i)
+                    soma -= valores[p] * resultado.x[indicesColuna[p]];
+
+            resultado.x[i] = soma / diagonal[i];
+        }
+
+        resultado.iteracoes++;
+        resultado.residuo = residuoRelativo(A, b, resultado.x, r, normaB, opcoes.threads);
+        resultado.historico.push_back(resultado.residuo);
+    }
+
+    resultado.convergiu = resultado.residuo <= opcoes.tolerancia;
+    return resultado;
+}
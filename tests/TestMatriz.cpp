@@ -2,9 +2,36 @@
 #include <fstream>
 #include <stdexcept>
 #include <chrono>
+#include <thread>
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include <sstream>
+#include <filesystem>
+#include <array>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
 #include "matriz/Matriz.hpp"
 #include <cassert>
+#include <cmath>
+#include <algorithm>
 #include "utils/utils.hpp"
+#include "matrizHibrida/MatrizHibrida.hpp"
+#include "matrizHash/MatrizHash.hpp"
+#include "matriz/ProdutoEsparso.hpp"
+#include "matriz/Potencia.hpp"
+#include "matrizCSR/MatrizCSR.hpp"
+#include "matrizDiagonal/MatrizDiagonal.hpp"
+#include "matriz/ConstrutorMatriz.hpp"
+#include "matriz/RecursoMonitorado.hpp"
+#include "solucionadores/Solucionadores.hpp"
+#include "solucionadores/FatoracaoSimetrica.hpp"
+#include "io/MatrizIO.hpp"
+#include "lote/Lote.hpp"
+#include "registro/RegistroMatrizes.hpp"
+#include "registro/CacheResultados.hpp"
+#include "matriz/VisaoMatriz.hpp"
 
 /*
  *   @brief Função de teste de inserção de valores na matriz.
@@ -50,60 +77,1986 @@ void testeSoma(const Matriz &A, const Matriz &B, const Matriz &soma)
         throw std::runtime_error("Erro: Dimensões incorretas na soma das matrizes.");
     }
 
-    // Verificando cada valor da matriz resultante
-    for (int i = 1; i <= soma.getLinhas(); i++)
+    // Verificando os valores da matriz resultante, percorrendo apenas os elementos das duas
+    if (auto diferenca = D.primeiraDiferenca(soma))
     {
-        for (int j = 1; j <= soma.getColunas(); j++)
+        throw std::runtime_error("Erro na soma das matrizes: Valor incorreto na posição (" +
+                                 std::to_string(diferenca->linha) + ", " + std::to_string(diferenca->coluna) + "). Esperado: " +
+                                 std::to_string(diferenca->valorB) + ", Obtido: " + std::to_string(diferenca->valorA));
+    }
+
+    std::cout << "Teste de soma passou" << std::endl;
+}
+
+/*
+ *    @brief Função de teste de multiplicação de matrizes.
+ *
+ *   Esta função recebe duas matrizes A e B e a matriz resultante da multiplicação dessas matrizes.
+ *  A função calcula a multiplicação das matrizes A e B e compara com a matriz resultante esperada.
+ * Se a matriz resultante da multiplicação for diferente da matriz esperada, a função lança uma exceção.
+ *
+ *   @param A Matriz A.
+ *  @param B Matriz B.
+ *
+ *   @throw std::runtime_error Se a matriz resultante da multiplicação for diferente da matriz esperada.
+ */
+void testeMultiplicacao(const Matriz &A, const Matriz &B, const Matriz &multi)
+{
+    Matriz D = multiply(A, B);
+
+    // Verificando as dimensões
+    if (D.getColunas() != multi.getColunas() || D.getLinhas() != multi.getLinhas())
+    {
+        throw std::runtime_error("Erro: Dimensões incorretas na multiplicação das matrizes.");
+    }
+
+    // Verificando os valores da matriz resultante, percorrendo apenas os elementos das duas
+    if (auto diferenca = D.primeiraDiferenca(multi))
+    {
+        throw std::runtime_error("Erro na multiplicação das matrizes: Valor incorreto na posição (" +
+                                 std::to_string(diferenca->linha) + ", " + std::to_string(diferenca->coluna) + "). Esperado: " +
+                                 std::to_string(diferenca->valorB) + ", Obtido: " + std::to_string(diferenca->valorA));
+    }
+
+    std::cout << "Teste de multiplicação passou" << std::endl;
+}
+
+/*
+ *   @brief Função de teste da representação híbrida (ladrilhos densos + parte esparsa).
+ *
+ *  Esta função monta matrizes 40x40 com blocos densos 8x8 na diagonal e acoplamentos esparsos
+ *  fora dela, converte para MatrizHibrida e compara os valores, a soma e a multiplicação com
+ *  os resultados obtidos pela Matriz encadeada.
+ */
+void testeMatrizHibrida()
+{
+    Matriz A(40, 40), B(40, 40);
+
+    for (int bloco = 0; bloco < 5; bloco++)
+    {
+        for (int i = 1; i <= 8; i++)
+        {
+            for (int j = 1; j <= 8; j++)
+            {
+                A.insert(bloco * 8 + i, bloco * 8 + j, i + j);
+                B.insert(bloco * 8 + i, bloco * 8 + j, i - j + 0.5);
+            }
+        }
+    }
+
+    for (int i = 1; i <= 40; i += 7)
+    {
+        A.insert(i, 41 - i, 3);
+        B.insert(41 - i, i, -2);
+    }
+
+    MatrizHibrida hA(A, 8), hB(B, 8);
+    assert(hA.quantidadeBlocos() == 5); // Apenas os blocos da diagonal são densos
+    assert(hB.quantidadeBlocos() == 5);
+
+    Matriz soma = sum(A, B);
+    Matriz multi = multiply(A, B);
+    MatrizHibrida hSoma = sum(hA, hB);
+    MatrizHibrida hMulti = multiply(hA, hB);
+    Matriz convertida = hA.paraMatriz();
+
+    for (int i = 1; i <= 40; i++)
+    {
+        for (int j = 1; j <= 40; j++)
+        {
+            assert(hA.get(i, j) == A.get(i, j));
+            assert(convertida.get(i, j) == A.get(i, j));
+            assert(hSoma.get(i, j) == soma.get(i, j));
+            assert(std::fabs(hMulti.get(i, j) - multi.get(i, j)) < 1e-9);
+        }
+    }
+
+    // Partes esparsas montadas em lote pelo ConstrutorMatriz
+    assert(convertida == A && convertida.verificarIntegridade());
+    assert(hSoma.paraMatriz() == soma && hSoma.getEsparsa().verificarIntegridade());
+    assert(hMulti.getEsparsa().verificarIntegridade());
+
+    std::cout << "Teste de matriz híbrida passou" << std::endl;
+}
+
+/*
+ *   @brief Função de teste da matriz em tabela hash.
+ *
+ *  Esta função aplica a mesma sequência de inserções, atualizações e remoções em uma Matriz e em
+ *  uma MatrizHash, forçando vários redimensionamentos da tabela, e verifica que ambas guardam os
+ *  mesmos valores, inclusive após a conversão para a Matriz encadeada.
+ */
+void testeMatrizHash()
+{
+    Matriz referencia(50, 50);
+    MatrizHash hash(50, 50);
+
+    for (int k = 0; k < 2000; k++)
+    {
+        int i = (k * 37) % 50 + 1;
+        int j = (k * 11 + k / 50) % 50 + 1;
+
+        if (k % 5 == 4)
+        {
+            assert(hash.erase(i, j) == referencia.erase(i, j));
+        }
+        else
+        {
+            hash.insert(i, j, k + 1);
+            referencia.insert(i, j, k + 1);
+        }
+    }
+
+    Matriz convertida = hash.paraMatriz();
+    size_t quantidade = 0;
+
+    for (int i = 1; i <= 50; i++)
+    {
+        for (int j = 1; j <= 50; j++)
+        {
+            assert(hash.get(i, j) == referencia.get(i, j));
+            assert(convertida.get(i, j) == referencia.get(i, j));
+            if (referencia.get(i, j) != 0)
+                quantidade++;
+        }
+    }
+    assert(hash.quantidade() == quantidade);
+
+    hash.limpar();
+    assert(hash.quantidade() == 0 && hash.get(1, 1) == 0);
+
+    std::cout << "Teste de matriz hash passou" << std::endl;
+}
+
+/*
+ *   @brief Teste de estresse do modo concorrente de escrita.
+ *
+ *  Várias threads inserem e removem elementos em posições que se sobrepõem entre si, na mesma
+ *  matriz, com o modo concorrente habilitado. Ao final, a função verifica a integridade das listas
+ *  de linhas e colunas e compara o conteúdo com o resultado esperado.
+ */
+void testeInsercaoConcorrente()
+{
+    const int tamanho = 120, quantidadeThreads = 8, operacoes = 6000;
+
+    Matriz matriz(tamanho, tamanho);
+    matriz.habilitarConcorrencia(16);
+
+    // O valor depende apenas da posição, então a ordem entre as threads não altera o resultado
+    auto posicao = [&](int t, int k)
+    {
+        return std::make_pair((t * 7919 + k * 31) % tamanho + 1, (t * 104729 + k * 17) % tamanho + 1);
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < quantidadeThreads; t++)
+    {
+        threads.emplace_back([&, t]()
+                             {
+                                 for (int k = 0; k < operacoes; k++)
+                                 {
+                                     auto [i, j] = posicao(t, k);
+                                     matriz.insert(i, j, i * 1000.0 + j);
+                                     // Na coluna 1 inserções e remoções disputam as mesmas posições
+                                     if (j == 1 && t == 0)
+                                         matriz.erase(i, j);
+                                 } });
+    }
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    assert(matriz.verificarIntegridade());
+
+    std::set<std::pair<int, int>> esperadas;
+    for (int t = 0; t < quantidadeThreads; t++)
+    {
+        for (int k = 0; k < operacoes; k++)
+        {
+            auto par = posicao(t, k);
+            if (par.second != 1)
+                esperadas.insert(par);
+        }
+    }
+
+    // O conteúdo final da coluna 1 depende do escalonamento das threads e não é conferido
+    size_t quantidade = 0;
+    for (IteratorM it = matriz.begin(); it != matriz.end(); ++it)
+    {
+        if (it.coluna() == 1)
+            continue;
+
+        assert(esperadas.count({it.linha(), it.coluna()}) == 1);
+        assert(*it == it.linha() * 1000.0 + it.coluna());
+        quantidade++;
+    }
+    assert(quantidade == esperadas.size());
+
+    // A atribuição troca apenas os dados: a matriz de destino continua no modo concorrente
+    Matriz origem(tamanho, tamanho);
+    origem.insert(1, 1, 1.0);
+    matriz = origem;
+    assert(matriz.get(1, 1) == 1.0 && origem.get(1, 1) == 1.0);
+
+    threads.clear();
+    for (int t = 0; t < quantidadeThreads; t++)
+    {
+        threads.emplace_back([&, t]()
+                             {
+                                 // Cada thread preenche as próprias linhas, atravessando todas as colunas
+                                 for (int i = t + 2; i <= tamanho; i += quantidadeThreads)
+                                 {
+                                     for (int j = 1; j <= tamanho; j++)
+                                         matriz.insert(i, j, i * 1000.0 + j);
+                                 } });
+    }
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    assert(matriz.verificarIntegridade());
+    assert(matriz.quantidade() == static_cast<size_t>(tamanho - 1) * tamanho + 1);
+    assert(origem.quantidade() == 1);
+
+    std::cout << "Teste de inserção concorrente passou" << std::endl;
+}
+
+/*
+ *   @brief Função de teste do compartilhamento com cópia sob escrita (copy-on-write).
+ *
+ *  Esta função verifica que cópias, atribuições e inserções em um mapa compartilham a estrutura
+ *  da matriz original, e que a primeira alteração (insert, erase, limpar ou escrita pelo iterador)
+ *  separa apenas a matriz alterada, sem afetar as demais.
+ */
+void testeCopiaSobEscrita()
+{
+    Matriz A(4, 4);
+    A.insert(1, 1, 1);
+    A.insert(3, 2, 2);
+
+    Matriz B = A;
+    assert(A.compartilhada() && B.compartilhada());
+
+    B.insert(2, 2, 5);
+    assert(!A.compartilhada() && !B.compartilhada());
+    assert(A.get(2, 2) == 0 && B.get(2, 2) == 5 && B.get(3, 2) == 2);
+
+    Matriz C;
+    C = A;
+    assert(C.compartilhada());
+    C.limpar();
+    assert(A.get(1, 1) == 1 && C.get(1, 1) == 0);
+
+    Matriz D = A;
+    *D.begin() = 42; // Escrita pelo iterador também separa a estrutura
+    assert(A.get(1, 1) == 1 && D.get(1, 1) == 42);
+
+    // Percorrer uma matriz const não separa a estrutura, e o iterador const não permite escrita
+    static_assert(std::is_same_v<decltype(*std::declval<const Matriz &>().begin()), const double &>);
+    Matriz E = A;
+    const Matriz &leitura = E;
+    double soma = 0;
+    for (ConstIteratorM it = leitura.begin(); it != leitura.end(); ++it)
+        soma += *it;
+    assert(soma == 3 && A.compartilhada() && E.compartilhada());
+
+    // O iterador mutável é obtido depois da cópia: a escrita fica só nesta matriz
+    Matriz F = E;
+    for (IteratorM it = F.begin(); it != F.end(); ++it)
+        *it = *it * 10;
+    assert(F.get(3, 2) == 20 && E.get(3, 2) == 2 && A.get(3, 2) == 2);
+
+    // Remover uma posição vazia não separa a estrutura nem muda a identidade ou a versão
+    Matriz G = A;
+    const uint64_t identidadeG = G.getIdentidade(), versaoG = G.getVersao();
+    assert(!G.erase(4, 4) && G.compartilhada() && A.compartilhada());
+    assert(G.getIdentidade() == identidadeG && G.getVersao() == versaoG);
+    assert(G.erase(1, 1) && !G.compartilhada() && A.get(1, 1) == 1 && G.get(1, 1) == 0);
+
+    std::unordered_map<std::string, Matriz> registro;
+    registro.insert(std::make_pair("A", A));
+    assert(A.compartilhada());
+    registro["A"].erase(3, 2);
+    assert(A.get(3, 2) == 2 && registro["A"].get(3, 2) == 0);
+
+    assert(A.verificarIntegridade() && B.verificarIntegridade() && C.verificarIntegridade() && D.verificarIntegridade());
+
+    std::cout << "Teste de cópia sob escrita passou" << std::endl;
+}
+
+/*
+ *  @brief Testa o modo lote e os formatos de arquivo texto e binário.
+ *
+ *  Executa a multiplicação de Matrix1 por Matrix2 pela linha de comando do modo lote, grava o
+ *  resultado em binário e compara com MatrixMulti1. Também verifica que passos inválidos
+ *  interrompem o lote com código de erro.
+ */
+void testeModoLote()
+{
+    const std::string binario = (std::filesystem::temp_directory_path() / "teste_lote_multi.bin").string();
+    const std::string texto = (std::filesystem::temp_directory_path() / "teste_lote_multi.txt").string();
+
+    std::ostringstream saida;
+    int codigo = executarLote({"--load", "A=tests/arquivosTestes/Matrix1.txt",
+                               "--load", "B=tests/arquivosTestes/Matrix2.txt",
+                               "--mul", "C=A,B",
+                               "--save", "C=" + binario,
+                               "--save", "C=" + texto},
+                              saida);
+    assert(codigo == 0);
+    assert(saida.str().find("mul C=A,B") != std::string::npos);
+
+    Matriz esperada = lerMatrizTexto("tests/arquivosTestes/MatrixMulti1.txt");
+    Matriz lidaBinaria = lerMatriz(binario);
+    Matriz lidaTexto = lerMatriz(texto);
+
+    assert(lidaBinaria.getLinhas() == esperada.getLinhas() && lidaBinaria.getColunas() == esperada.getColunas());
+    assert(lidaBinaria == esperada && lidaTexto == esperada);
+
+    assert(lidaBinaria.verificarIntegridade());
+
+    // Quantidade de elementos adulterada (logo após assinatura, versão, linhas e colunas) ou arquivo truncado
+    const std::string adulterado = (std::filesystem::temp_directory_path() / "teste_lote_adulterado.bin").string();
+    for (const bool truncar : {false, true})
+    {
+        std::filesystem::copy_file(binario, adulterado, std::filesystem::copy_options::overwrite_existing);
+        if (truncar)
+        {
+            std::filesystem::resize_file(adulterado, std::filesystem::file_size(adulterado) - 8);
+        }
+        else
+        {
+            std::fstream arquivo(adulterado, std::ios::in | std::ios::out | std::ios::binary);
+            const uint64_t quantidade = std::numeric_limits<uint64_t>::max() / 2;
+            arquivo.seekp(16);
+            arquivo.write(reinterpret_cast<const char *>(&quantidade), sizeof(quantidade));
+        }
+
+        bool rejeitado = false;
+        try
+        {
+            lerMatrizBinaria(adulterado);
+        }
+        catch (const std::runtime_error &)
+        {
+            rejeitado = true;
+        }
+        assert(rejeitado);
+    }
+    std::filesystem::remove(adulterado);
+
+    std::ostringstream descartada;
+    assert(executarLote({"--mul", "C=A,B"}, descartada) == 1);     // Operandos não carregados
+    assert(executarLote({"--load", "A"}, descartada) == 1);        // Falta o '='
+    assert(executarLote({"--inverter", "A=B"}, descartada) == 1);  // Comando desconhecido
+    assert(executarLote({"--prune", "A=-1"}, descartada) == 1);    // Tolerância negativa
+
+    std::ostringstream podada;
+    assert(executarLote({"--load", "C=" + binario, "--prune", "C=0,1", "--save", "C=" + texto}, podada) == 0);
+    const Matriz umPorLinha = lerMatriz(texto);
+    for (int i = 1; i <= umPorLinha.getLinhas(); i++)
+        assert(umPorLinha.quantidadeLinha(i) == std::min(1, esperada.quantidadeLinha(i)));
+    assert(podada.str().find("elementos removidos") != std::string::npos);
+
+    std::filesystem::remove(binario);
+    std::filesystem::remove(texto);
+
+    std::cout << "Teste de modo lote passou" << std::endl;
+}
+
+/*
+ *  @brief Testa a leitura e a escrita no formato Matrix Market.
+ *
+ *  Cobre as variantes general, symmetric e pattern, a leitura em paralelo (comparada com a
+ *  leitura em uma única thread) e a ida e volta pela escrita.
+ */
+void testeMatrixMarket()
+{
+    const auto pasta = std::filesystem::temp_directory_path();
+    const std::string simetrico = (pasta / "teste_mm_simetrico.mtx").string();
+    const std::string padrao = (pasta / "teste_mm_padrao.mtx").string();
+    const std::string grande = (pasta / "teste_mm_grande.mtx").string();
+
+    std::ofstream(simetrico) << "%%MatrixMarket matrix coordinate real symmetric\n"
+                             << "% comentario\n"
+                             << "4 4 3\n"
+                             << "1 1 2.5\n"
+                             << "3 1 -1\n"
+                             << "4 2 7e1\n";
+
+    Matriz S = lerMatrizMM(simetrico);
+    assert(S.get(1, 1) == 2.5 && S.get(3, 1) == -1 && S.get(1, 3) == -1);
+    assert(S.get(4, 2) == 70 && S.get(2, 4) == 70 && S.get(2, 2) == 0);
+    assert(S.verificarIntegridade());
+
+    std::ofstream(padrao) << "%%MatrixMarket matrix coordinate pattern general\n"
+                          << "2 3 2\n"
+                          << "1 3\n"
+                          << "2 1\n";
+
+    Matriz P = lerMatriz(padrao);
+    assert(P.getLinhas() == 2 && P.getColunas() == 3);
+    assert(P.get(1, 3) == 1 && P.get(2, 1) == 1 && P.get(1, 1) == 0);
+
+    // Ida e volta pela escrita, inclusive gravando apenas o triângulo inferior
+    escreverMatrizMM(S, simetrico, true);
+    Matriz S2 = lerMatrizMM(simetrico);
+    assert(S2 == S);
+
+    bool rejeitada = false;
+    try
+    {
+        escreverMatrizMM(P, padrao, true);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitada = true;
+    }
+    assert(rejeitada);
+
+    // Arquivo maior, fora de ordem, lido com várias threads
+    Matriz G(300, 200);
+    {
+        std::ofstream file(grande);
+        file << "%%MatrixMarket matrix coordinate integer general\n300 200 6000\n";
+        for (int k = 0; k < 6000; k++)
+        {
+            int i = (k * 7919) % 300 + 1, j = (k * 104729) % 200 + 1;
+            file << i << " " << j << " " << k + 1 << "\n";
+            G.insert(i, j, k + 1);
+        }
+    }
+
+    Matriz G1 = lerMatrizMM(grande, 1);
+    Matriz G4 = lerMatrizMM(grande, 4);
+    assert(G1 == G && G4 == G);
+    assert(G4.verificarIntegridade());
+
+    std::ofstream(padrao) << "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 x 3\n";
+    rejeitada = false;
+    try
+    {
+        lerMatrizMM(padrao);
+    }
+    catch (const std::runtime_error &)
+    {
+        rejeitada = true;
+    }
+    assert(rejeitada);
+
+    // Quantidade declarada maior do que cabe no arquivo: rejeitada antes de qualquer reserva
+    std::ofstream(padrao) << "%%MatrixMarket matrix coordinate real general\n3 3 4000000000000\n1 1 1\n";
+    rejeitada = false;
+    try
+    {
+        lerMatrizMM(padrao);
+    }
+    catch (const std::runtime_error &)
+    {
+        rejeitada = true;
+    }
+    assert(rejeitada);
+
+    std::filesystem::remove(simetrico);
+    std::filesystem::remove(padrao);
+    std::filesystem::remove(grande);
+
+    std::cout << "Teste de Matrix Market passou" << std::endl;
+}
+
+/*
+ *  @brief Testa o formato compactado com cada codificação de valores.
+ *
+ *  Verifica a ida e volta exata (Double, Dicionario e Automatico), a redução para float e que o
+ *  arquivo compactado fica menor que o binário simples.
+ */
+void testeFormatoCompactado()
+{
+    const auto pasta = std::filesystem::temp_directory_path();
+    const std::string compactado = (pasta / "teste_compactado.mec").string();
+    const std::string binario = (pasta / "teste_compactado.bin").string();
+
+    // Matriz banda com poucos valores distintos e linhas vazias
+    Matriz A(2000, 1500);
+    for (int i = 1; i <= 2000; i += 3)
+        for (int j = std::max(1, i - 40); j <= std::min(1500, i + 40); j += 2)
+            A.insert(i, j, (i + j) % 5 + 0.5);
+    A.insert(2000, 1500, 1.0 / 3.0);
+
+    const ValoresCompactados modos[] = {ValoresCompactados::Automatico, ValoresCompactados::Double,
+                                        ValoresCompactados::Dicionario, ValoresCompactados::Float};
+
+    // Matriz de valores inteiros, incluindo negativos
+    Matriz I(50, 50);
+    for (int i = 1; i <= 50; i++)
+        I.insert(i, (i * 7) % 50 + 1, (i % 2 ? -1 : 1) * i * 1000.0);
+
+    escreverMatrizCompactada(I, compactado, ValoresCompactados::Inteiro);
+    Matriz lidaInteira = lerMatrizCompactada(compactado);
+    for (int i = 1; i <= 50; i++)
+        assert(lidaInteira.get(i, (i * 7) % 50 + 1) == (i % 2 ? -1 : 1) * i * 1000.0);
+
+    for (ValoresCompactados modo : modos)
+    {
+        escreverMatrizCompactada(A, compactado, modo);
+        Matriz lida = lerMatrizCompactada(compactado);
+
+        assert(lida.getLinhas() == 2000 && lida.getColunas() == 1500);
+        assert(lida.verificarIntegridade());
+
+        for (IteratorM it = A.begin(); it != A.end(); ++it)
+        {
+            if (modo == ValoresCompactados::Float)
+                assert(lida.get(it.linha(), it.coluna()) == static_cast<double>(static_cast<float>(*it)));
+            else
+                assert(lida.get(it.linha(), it.coluna()) == *it);
+        }
+    }
+
+    escreverMatriz(A, compactado); // Automático pela extensão .mec
+    escreverMatriz(A, binario);
+    assert(std::filesystem::file_size(compactado) * 3 < std::filesystem::file_size(binario));
+
+    Matriz lida = lerMatriz(compactado);
+    assert(lida.get(2000, 1500) == 1.0 / 3.0 && lida.get(1, 1) == A.get(1, 1));
+
+    // Arquivo truncado
+    std::filesystem::resize_file(compactado, std::filesystem::file_size(compactado) / 2);
+    bool rejeitado = false;
+    try
+    {
+        lerMatrizCompactada(compactado);
+    }
+    catch (const std::runtime_error &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    // Quantidade de elementos (após assinatura, versão, codificação, linhas e colunas) ou tamanho do
+    // dicionário adulterados: nada é reservado além do que cabe no arquivo
+    for (const bool adulterarDicionario : {false, true})
+    {
+        escreverMatrizCompactada(A, compactado, ValoresCompactados::Dicionario);
+        std::fstream arquivo(compactado, std::ios::in | std::ios::out | std::ios::binary);
+        if (adulterarDicionario)
+        {
+            const char tamanhoDicionario[] = {'\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\x7f'};
+            arquivo.seekp(25);
+            arquivo.write(tamanhoDicionario, sizeof(tamanhoDicionario));
+        }
+        else
+        {
+            const uint64_t quantidade = std::numeric_limits<uint64_t>::max() / 2;
+            arquivo.seekp(17);
+            arquivo.write(reinterpret_cast<const char *>(&quantidade), sizeof(quantidade));
+        }
+        arquivo.close();
+
+        rejeitado = false;
+        try
+        {
+            lerMatrizCompactada(compactado);
+        }
+        catch (const std::runtime_error &)
+        {
+            rejeitado = true;
+        }
+        assert(rejeitado);
+    }
+
+    std::filesystem::remove(compactado);
+    std::filesystem::remove(binario);
+
+    std::cout << "Teste de formato compactado passou" << std::endl;
+}
+
+/*
+ *  @brief Testa a multiplicação em duas fases (ProdutoEsparso).
+ *
+ *  Compara a fase numérica com multiply() após alterar apenas os valores de A e B, verifica que
+ *  a estrutura do resultado é reaproveitada, que cópias do resultado não são alteradas e que um
+ *  elemento fora do padrão simbólico é rejeitado.
+ */
+void testeProdutoEsparso()
+{
+    Matriz A(30, 20), B(20, 25);
+    for (int i = 1; i < 30; i++) // A linha 30 de A fica vazia
+        for (int j = 1 + i % 3; j <= 20; j += 4)
+            A.insert(i, j, i + j);
+    for (int i = 1; i <= 20; i++)
+        for (int j = 1 + i % 5; j <= 25; j += 6)
+            B.insert(i, j, i - j + 0.5);
+
+    ProdutoEsparso produto(A, B);
+    Matriz esperado = multiply(A, B);
+
+    for (int i = 1; i <= 30; i++)
+        for (int j = 1; j <= 25; j++)
+            assert(std::fabs(produto.getResultado().get(i, j) - esperado.get(i, j)) < 1e-9);
+
+    const Matriz anterior = produto.getResultado(); // Cópia compartilhada com o resultado
+    const Node *primeiro = produto.getResultado().getSentinelaLinha(1)->direita;
+
+    for (int passo = 1; passo <= 3; passo++)
+    {
+        // Mesmo padrão, valores novos
+        for (IteratorM it = A.begin(); it != A.end(); ++it)
+            *it = *it * 0.5 + passo;
+        for (IteratorM it = B.begin(); it != B.end(); ++it)
+            *it = -*it;
+
+        const Matriz &C = produto.calcular(A, B);
+        esperado = multiply(A, B);
+
+        for (int i = 1; i <= 30; i++)
+            for (int j = 1; j <= 25; j++)
+                assert(std::fabs(C.get(i, j) - esperado.get(i, j)) < 1e-9);
+
+        if (passo > 1) // Após separar da cópia, os nós do resultado não mudam mais
+            assert(C.getSentinelaLinha(1)->direita == primeiro);
+        primeiro = C.getSentinelaLinha(1)->direita;
+    }
+
+    assert(anterior.get(1, 1) != produto.getResultado().get(1, 1) || anterior.get(1, 1) == 0);
+    assert(produto.getResultado().verificarIntegridade());
+
+    // Elemento novo em A que gera posições fora do padrão (a linha 30 de C não tem posições)
+    A.insert(30, 1, 1);
+    bool rejeitado = false;
+    try
+    {
+        produto.calcular(A, B);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de produto em duas fases passou" << std::endl;
+}
+
+/*
+ *  @brief Testa as operações no lugar: +=, -=, adicionarEscalado, *= e hadamard.
+ *
+ *  Compara cada operação com o cálculo elemento a elemento, verifica a remoção de elementos que
+ *  se anulam, o uso da própria matriz como operando e a independência de cópias compartilhadas.
+ */
+void testeOperacoesNoLugar()
+{
+    Matriz A(40, 30), B(40, 30);
+    for (int i = 1; i <= 40; i++)
+        for (int j = 1 + i % 4; j <= 30; j += 3)
+            A.insert(i, j, i * j % 7 + 1);
+    for (int i = 2; i <= 40; i += 2)
+        for (int j = 1 + i % 5; j <= 30; j += 2)
+            B.insert(i, j, (i + j) % 3 - 1.5);
+
+    const Matriz copiaA = A; // Deve permanecer inalterada
+    const double alfa = 2.5;
+
+    Matriz S = A;
+    S += B;
+    Matriz D = A;
+    D -= B;
+    Matriz E = A;
+    E.adicionarEscalado(alfa, B);
+    Matriz M = A;
+    M *= -0.5;
+    Matriz H = A;
+    H.hadamard(B);
+
+    for (int i = 1; i <= 40; i++)
+    {
+        for (int j = 1; j <= 30; j++)
+        {
+            assert(S.get(i, j) == copiaA.get(i, j) + B.get(i, j));
+            assert(D.get(i, j) == copiaA.get(i, j) - B.get(i, j));
+            assert(E.get(i, j) == copiaA.get(i, j) + alfa * B.get(i, j));
+            assert(M.get(i, j) == copiaA.get(i, j) * -0.5);
+            assert(H.get(i, j) == copiaA.get(i, j) * B.get(i, j));
+        }
+    }
+
+    // Elementos que se anulam são removidos das listas
+    Matriz Z = A;
+    Z -= A;
+    assert(Z.begin() == Z.end());
+    Z = A;
+    Z.adicionarEscalado(-1, Z);
+    assert(Z.begin() == Z.end());
+    assert(A.get(1, 2) == copiaA.get(1, 2));
+
+    Matriz Q = A;
+    Q.hadamard(Q);
+    assert(Q.get(1, 2) == copiaA.get(1, 2) * copiaA.get(1, 2));
+
+    size_t elementosH = 0, elementosB = 0;
+    for (IteratorM it = H.begin(); it != H.end(); ++it, elementosH++)
+        assert(*it != 0);
+    for (IteratorM it = B.begin(); it != B.end(); ++it)
+        elementosB++;
+    assert(elementosH <= elementosB);
+
+    M *= 0;
+    assert(M.begin() == M.end());
+
+    assert(S.verificarIntegridade() && D.verificarIntegridade() && E.verificarIntegridade());
+    assert(H.verificarIntegridade() && Z.verificarIntegridade() && Q.verificarIntegridade());
+
+    bool rejeitado = false;
+    try
+    {
+        Matriz pequena(2, 2);
+        S += pequena;
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de operações no lugar passou" << std::endl;
+}
+
+/*
+ *  @brief Testa power() por quadrados sucessivos.
+ *
+ *  Compara com multiplicações encadeadas em um grafo qualquer e em um grafo completo (padrão
+ *  estável, que usa os buffers alternados), e verifica as saídas antecipadas para matrizes
+ *  nilpotentes e idempotentes e a chamada do gancho de poda.
+ */
+void testePotencia()
+{
+    auto proximas = [](const Matriz &X, const Matriz &Y)
+    {
+        for (int i = 1; i <= X.getLinhas(); i++)
+            for (int j = 1; j <= X.getColunas(); j++)
+                if (std::fabs(X.get(i, j) - Y.get(i, j)) > 1e-9 * std::max(1.0, std::fabs(Y.get(i, j))))
+                    return false;
+        return true;
+    };
+
+    Matriz G(25, 25), completo(6, 6);
+    for (int i = 1; i <= 25; i++)
+    {
+        G.insert(i, i % 25 + 1, 1);
+        G.insert(i, (i * 7) % 25 + 1, 1);
+    }
+    for (int i = 1; i <= 6; i++)
+        for (int j = 1; j <= 6; j++)
+            completo.insert(i, j, 1);
+
+    Matriz encadeadaG = G, encadeadaC = completo;
+    for (int k = 1; k <= 20; k++)
+    {
+        assert(proximas(power(G, k), encadeadaG));
+        assert(proximas(power(completo, k), encadeadaC));
+        encadeadaG = multiply(encadeadaG, G);
+        encadeadaC = multiply(encadeadaC, completo);
+    }
+
+    Matriz identidade = power(G, 0);
+    for (int i = 1; i <= 25; i++)
+        assert(identidade.get(i, i) == 1);
+
+    // Nilpotente: triangular estritamente superior
+    Matriz N(8, 8);
+    for (int i = 1; i < 8; i++)
+        N.insert(i, i + 1, 2);
+    Matriz nula = power(N, 20);
+    assert(nula.begin() == nula.end());
+    assert(power(N, 7).get(1, 8) == 128);
+
+    // Idempotente: P * P == P
+    Matriz P(4, 4);
+    for (int i = 1; i <= 4; i++)
+        for (int j = 1; j <= 4; j++)
+            P.insert(i, j, 0.25);
+    assert(proximas(power(P, 19), P));
+
+    // Gancho de poda: mantém apenas a diagonal quando há elementos demais
+    int chamadas = 0;
+    OpcoesPotencia opcoes;
+    opcoes.limiteElementos = 30;
+    opcoes.poda = [&chamadas](Matriz &M)
+    {
+        chamadas++;
+        for (int i = 1; i <= M.getLinhas(); i++)
+            for (int j = 1; j <= M.getColunas(); j++)
+                if (i != j)
+                    M.erase(i, j);
+    };
+    Matriz podada = power(G, 6, opcoes);
+    assert(chamadas > 0 && podada.verificarIntegridade());
+
+    bool rejeitado = false;
+    try
+    {
+        power(Matriz(2, 3), 2);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de potência passou" << std::endl;
+}
+
+/*
+ *  @brief Testa os produtos com transposta (Aᵀ * B, A * Bᵀ e Aᵀ * A).
+ *
+ *  Os resultados são comparados com multiply() aplicado às transpostas montadas explicitamente.
+ */
+void testeProdutosTranspostos()
+{
+    auto transpor = [](const Matriz &M)
+    {
+        Matriz T(M.getColunas(), M.getLinhas());
+        for (ConstIteratorM it = M.begin(); it != M.end(); ++it)
+            T.insert(it.coluna(), it.linha(), *it);
+        return T;
+    };
+
+    auto iguais = [](const Matriz &X, const Matriz &Y)
+    {
+        return X.approxEqual(Y, 0.0, 1e-9);
+    };
+
+    Matriz A(35, 20), B(35, 15), C(25, 20);
+    for (int i = 1; i <= 35; i++)
+    {
+        for (int j = 1 + i % 3; j <= 20; j += 5)
+            A.insert(i, j, i - j * 0.5);
+        for (int j = 1 + i % 4; j <= 15; j += 4)
+            B.insert(i, j, i * 0.25 + j);
+    }
+    for (int i = 1; i <= 25; i++)
+        for (int j = 1 + i % 6; j <= 20; j += 3)
+            C.insert(i, j, (i + j) % 4 - 1);
+
+    assert(iguais(multiplyTransA(A, B), multiply(transpor(A), B)));
+    assert(iguais(multiplyTransB(A, C), multiply(A, transpor(C))));
+
+    Matriz gram = multiplyGram(A);
+    Matriz superior = multiplyGram(A, true);
+    assert(iguais(gram, multiply(transpor(A), A)));
+    assert(gram.verificarIntegridade());
+
+    for (int i = 1; i <= 20; i++)
+        for (int j = 1; j <= 20; j++)
+            assert(superior.get(i, j) == (j >= i ? gram.get(i, j) : 0));
+
+    bool rejeitado = false;
+    try
+    {
+        multiplyTransA(A, C);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de produtos com transposta passou" << std::endl;
+}
+
+/*
+ *  @brief Testa a forma CSR e os métodos iterativos (gradiente conjugado, Jacobi e Gauss-Seidel).
+ *
+ *  Usa um sistema simétrico definido positivo e diagonalmente dominante (laplaciano 2D com
+ *  reforço na diagonal) cuja solução é conhecida, e compara o produto matriz-vetor paralelo
+ *  com o sequencial.
+ */
+void testeSolucionadores()
+{
+    const int lado = 12, n = lado * lado;
+    Matriz A(n, n);
+
+    for (int i = 1; i <= lado; i++)
+    {
+        for (int j = 1; j <= lado; j++)
+        {
+            const int k = (i - 1) * lado + j;
+            A.insert(k, k, 4.5);
+            if (j > 1)
+                A.insert(k, k - 1, -1);
+            if (j < lado)
+                A.insert(k, k + 1, -1);
+            if (i > 1)
+                A.insert(k, k - lado, -1);
+            if (i < lado)
+                A.insert(k, k + lado, -1);
+        }
+    }
+
+    MatrizCSR csr(A);
+    std::vector<double> esperado(n), b, bParalelo;
+    for (int i = 0; i < n; i++)
+        esperado[i] = std::sin(i + 1.0);
+
+    csr.multiplicar(esperado, b, 1);
+    csr.multiplicar(esperado, bParalelo, 4);
+    assert(b == bParalelo);
+    assert(csr.quantidade() == static_cast<size_t>(5 * n - 4 * lado));
+    assert(csr.diagonal()[7] == 4.5);
+
+    OpcoesSolucionador opcoes;
+    opcoes.tolerancia = 1e-12;
+    opcoes.threads = 2;
+
+    ResultadoSolucionador cg = gradienteConjugado(A, b, opcoes);
+    ResultadoSolucionador jac = jacobi(A, b, opcoes);
+    ResultadoSolucionador gs = gaussSeidel(A, b, opcoes);
+
+    for (const ResultadoSolucionador *resultado : {&cg, &jac, &gs})
+    {
+        assert(resultado->convergiu && resultado->residuo <= 1e-12);
+        assert(resultado->historico.size() == static_cast<size_t>(resultado->iteracoes) + 1);
+        for (int i = 0; i < n; i++)
+            assert(std::fabs(resultado->x[i] - esperado[i]) < 1e-9);
+    }
+
+    // Gradiente conjugado precisa de bem menos iterações; Gauss-Seidel, menos que Jacobi
+    assert(cg.iteracoes < gs.iteracoes && gs.iteracoes < jac.iteracoes);
+
+    opcoes.maxIteracoes = 3;
+    ResultadoSolucionador limitado = jacobi(A, b, opcoes);
+    assert(!limitado.convergiu && limitado.iteracoes == 3);
+    assert(limitado.historico.back() < limitado.historico.front());
+
+    // Partindo da solução, nenhuma iteração é necessária
+    ResultadoSolucionador pronto = gradienteConjugado(A, b, opcoes, esperado);
+    assert(pronto.iteracoes <= 1 && pronto.convergiu);
+
+    bool rejeitado = false;
+    try
+    {
+        jacobi(A, std::vector<double>(n - 1, 1.0));
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de solucionadores iterativos passou" << std::endl;
+}
+
+/*
+ *  @brief Testa a fatoração direta (Cholesky e LDLᵀ) com ordenação de mínimo grau.
+ *
+ *  Verifica que L Lᵀ reproduz P A Pᵀ, que a ordenação reduz o preenchimento do laplaciano 2D,
+ *  que o fator resolve vários lados direitos e que refatorar() reaproveita a análise simbólica.
+ */
+void testeFatoracaoSimetrica()
+{
+    const int lado = 10, n = lado * lado;
+    Matriz A(n, n);
+
+    for (int i = 1; i <= lado; i++)
+    {
+        for (int j = 1; j <= lado; j++)
+        {
+            const int k = (i - 1) * lado + j;
+            A.insert(k, k, 4);
+            if (j > 1)
+                A.insert(k, k - 1, -1);
+            if (j < lado)
+                A.insert(k, k + 1, -1);
+            if (i > 1)
+                A.insert(k, k - lado, -1);
+            if (i < lado)
+                A.insert(k, k + lado, -1);
+        }
+    }
+
+    FatoracaoSimetrica natural(A, TipoFatoracao::Cholesky, OrdenacaoFatoracao::Natural);
+    FatoracaoSimetrica ordenada(A);
+
+    // Na ordem natural o fator preenche toda a banda; o mínimo grau preenche bem menos
+    assert(natural.quantidadeFator() == static_cast<size_t>((n - lado) * lado + lado - 1));
+    assert(ordenada.quantidadeFator() < natural.quantidadeFator());
+
+    // L Lᵀ == P A Pᵀ
+    const Matriz L = ordenada.fator();
+    const Matriz LLt = multiplyTransB(L, L);
+    const std::vector<int> &P = ordenada.getPermutacao();
+    for (int k = 1; k <= n; k++)
+        for (int m = 1; m <= n; m++)
+            assert(std::fabs(LLt.get(k, m) - A.get(P[k - 1] + 1, P[m - 1] + 1)) < 1e-12);
+
+    // Árvore de eliminação: o pai de cada coluna vem depois dela
+    const std::vector<int> &pai = ordenada.getArvoreEliminacao();
+    for (int j = 0; j < n; j++)
+        assert(pai[j] == -1 || pai[j] > j);
+
+    for (int rodada = 0; rodada < 3; rodada++)
+    {
+        std::vector<double> esperado(n), b(n, 0.0);
+        for (int i = 0; i < n; i++)
+            esperado[i] = std::cos(i * (rodada + 1.0));
+
+        for (int i = 1; i <= n; i++)
+            for (int j = 1; j <= n; j++)
+                b[i - 1] += A.get(i, j) * esperado[j - 1];
+
+        for (const FatoracaoSimetrica *fatoracao : {&natural, &ordenada})
+        {
+            std::vector<double> x = fatoracao->resolver(b);
+            for (int i = 0; i < n; i++)
+                assert(std::fabs(x[i] - esperado[i]) < 1e-10);
+        }
+    }
+
+    // Mesmo padrão com valores dobrados: a solução cai pela metade
+    Matriz dobro = A;
+    dobro *= 2;
+    std::vector<double> uns(n, 1.0);
+    std::vector<double> antes = ordenada.resolver(uns);
+    ordenada.refatorar(dobro);
+    std::vector<double> depois = ordenada.resolver(uns);
+    for (int i = 0; i < n; i++)
+        assert(std::fabs(depois[i] - antes[i] / 2) < 1e-12);
+
+    // Simétrica indefinida: LDLᵀ fatora, Cholesky recusa
+    Matriz indefinida(3, 3);
+    indefinida.insert(1, 1, 1);
+    indefinida.insert(1, 2, 2);
+    indefinida.insert(2, 1, 2);
+    indefinida.insert(2, 2, 1);
+    indefinida.insert(3, 3, -3);
+
+    FatoracaoSimetrica ldlt(indefinida, TipoFatoracao::LDLT);
+    std::vector<double> x = ldlt.resolver({5, 4, 6});
+    assert(std::fabs(x[0] - 1) < 1e-12 && std::fabs(x[1] - 2) < 1e-12 && std::fabs(x[2] + 2) < 1e-12);
+
+    int rejeitadas = 0;
+    try
+    {
+        FatoracaoSimetrica cholesky(indefinida);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitadas++;
+    }
+
+    indefinida.insert(1, 3, 1);
+    try
+    {
+        FatoracaoSimetrica naoSimetrica(indefinida, TipoFatoracao::LDLT);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitadas++;
+    }
+
+    try
+    {
+        ldlt.refatorar(indefinida);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitadas++;
+    }
+    assert(rejeitadas == 3);
+
+    std::cout << "Teste de fatoração simétrica passou" << std::endl;
+}
+
+/*
+ *  @brief Testa applyPermutation(), reorderRCM() e as métricas de largura de banda e perfil.
+ *
+ *  Embaralha um laplaciano 2D (com alguns vértices isolados, para haver mais de um componente)
+ *  e verifica que a reordenação recupera uma banda estreita.
+ */
+void testeReordenacaoRCM()
+{
+    const int lado = 15, n = lado * lado + 5;
+    Matriz grade(n, n);
+
+    for (int i = 1; i <= lado; i++)
+    {
+        for (int j = 1; j <= lado; j++)
+        {
+            const int k = (i - 1) * lado + j;
+            grade.insert(k, k, 4);
+            if (j < lado)
+            {
+                grade.insert(k, k + 1, -1);
+                grade.insert(k + 1, k, -1);
+            }
+            if (i < lado)
+            {
+                grade.insert(k, k + lado, -1);
+                grade.insert(k + lado, k, -1);
+            }
+        }
+    }
+    for (int k = lado * lado + 1; k <= n; k++)
+        grade.insert(k, k, 1);
+
+    assert(grade.larguraBanda() == lado);
+
+    // Embaralhamento determinístico: k -> (k * 37) mod n
+    std::vector<int> embaralhada(n);
+    for (int k = 1; k <= n; k++)
+        embaralhada[k - 1] = (k * 37) % n + 1;
+
+    Matriz A = grade.applyPermutation(embaralhada, embaralhada);
+    assert(A.verificarIntegridade());
+    for (int i = 1; i <= n; i++)
+        for (int j = 1; j <= n; j++)
+            assert(A.get(i, j) == grade.get(embaralhada[i - 1], embaralhada[j - 1]));
+    assert(A.larguraBanda() > 4 * lado);
+
+    ReordenacaoRCM rcm = A.reorderRCM();
+    assert(rcm.matriz.verificarIntegridade());
+    assert(rcm.matriz.larguraBanda() <= lado + 1);
+    assert(rcm.matriz.perfil() < A.perfil());
+
+    std::vector<int> usados(rcm.permutacao);
+    std::sort(usados.begin(), usados.end());
+    for (int k = 1; k <= n; k++)
+        assert(usados[k - 1] == k);
+
+    for (int i = 1; i <= n; i++)
+        for (int j = 1; j <= n; j++)
+            assert(rcm.matriz.get(i, j) == A.get(rcm.permutacao[i - 1], rcm.permutacao[j - 1]));
+
+    // Permutação só das linhas em uma matriz retangular
+    Matriz R(3, 4);
+    R.insert(1, 2, 5);
+    R.insert(3, 4, 7);
+    Matriz trocada = R.applyPermutation({3, 1, 2}, {});
+    assert(trocada.get(1, 4) == 7 && trocada.get(2, 2) == 5 && trocada.verificarIntegridade());
+
+    int rejeitadas = 0;
+    for (const std::vector<int> &invalida : std::vector<std::vector<int>>{{1, 1, 2}, {1, 2}, {0, 1, 2}})
+    {
+        try
         {
-            if (D.get(i, j) != soma.get(i, j))
-            {
-                throw std::runtime_error("Erro na soma das matrizes: Valor incorreto na posição (" +
-                                         std::to_string(i) + ", " + std::to_string(j) + "). Esperado: " +
-                                         std::to_string(soma.get(i, j)) + ", Obtido: " + std::to_string(D.get(i, j)));
-            }
+            R.applyPermutation(invalida, {});
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejeitadas++;
         }
     }
+    try
+    {
+        R.reorderRCM();
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitadas++;
+    }
+    assert(rejeitadas == 4);
 
-    std::cout << "Teste de soma passou" << std::endl;
+    std::cout << "Teste de reordenação RCM passou" << std::endl;
 }
 
 /*
- *    @brief Função de teste de multiplicação de matrizes.
- *
- *   Esta função recebe duas matrizes A e B e a matriz resultante da multiplicação dessas matrizes.
- *  A função calcula a multiplicação das matrizes A e B e compara com a matriz resultante esperada.
- * Se a matriz resultante da multiplicação for diferente da matriz esperada, a função lança uma exceção.
- *
- *   @param A Matriz A.
- *  @param B Matriz B.
- *
- *   @throw std::runtime_error Se a matriz resultante da multiplicação for diferente da matriz esperada.
+ *  @brief Testa a representação por diagonais (DIA): detecção, kernels e o atalho de multiply() para matrizes diagonais.
  */
-void testeMultiplicacao(const Matriz &A, const Matriz &B, const Matriz &multi)
+void testeMatrizDiagonal()
 {
-    Matriz D = multiply(A, B);
+    auto iguais = [](const Matriz &X, const Matriz &Y)
+    {
+        return X.approxEqual(Y, 0.0, 1e-9);
+    };
 
-    // Verificando as dimensões
-    if (D.getColunas() != multi.getColunas() || D.getLinhas() != multi.getLinhas())
+    const int n = 40;
+    Matriz diagonal(n, n), tridiagonal(n, n), espalhada(n, n), B(n, 25);
+
+    for (int i = 1; i <= n; i++)
     {
-        throw std::runtime_error("Erro: Dimensões incorretas na multiplicação das matrizes.");
+        diagonal.insert(i, i, i % 7 == 0 ? 0 : i * 0.5);
+        tridiagonal.insert(i, i, 2 + i);
+        if (i > 1)
+            tridiagonal.insert(i, i - 1, -1);
+        if (i < n)
+            tridiagonal.insert(i, i + 1, i * 0.25);
+        espalhada.insert(i, (i * 17) % n + 1, i);
+        for (int j = 1 + i % 5; j <= 25; j += 6)
+            B.insert(i, j, i - j);
+    }
+
+    std::optional<MatrizDiagonal> D = MatrizDiagonal::detectar(diagonal);
+    std::optional<MatrizDiagonal> T = MatrizDiagonal::detectar(tridiagonal);
+    assert(D && D->diagonalPura() && D->quantidade() == static_cast<size_t>(n - n / 7));
+    assert(T && T->getDeslocamentos() == std::vector<int>({-1, 0, 1}) && T->quantidade() == static_cast<size_t>(3 * n - 2));
+    assert(!MatrizDiagonal::detectar(espalhada));
+    assert(MatrizDiagonal::apenasDiagonalPrincipal(diagonal) && !MatrizDiagonal::apenasDiagonalPrincipal(tridiagonal));
+
+    assert(iguais(D->paraMatriz(), diagonal) && iguais(T->paraMatriz(), tridiagonal));
+    assert(T->get(5, 6) == 1.25 && T->get(5, 7) == 0);
+
+    // Produto matriz-vetor igual ao da forma CSR
+    std::vector<double> x(n), y, yCSR;
+    for (int i = 0; i < n; i++)
+        x[i] = std::sin(i + 1.0);
+    T->multiplicar(x, y);
+    MatrizCSR(tridiagonal).multiplicar(x, yCSR);
+    for (int i = 0; i < n; i++)
+        assert(std::fabs(y[i] - yCSR[i]) < 1e-12);
+
+    // Soma e produto entre matrizes DIA
+    assert(iguais(sum(*D, *T).paraMatriz(), sum(diagonal, tridiagonal)));
+    MatrizDiagonal TT = multiply(*T, *T);
+    assert(TT.getDeslocamentos() == std::vector<int>({-2, -1, 0, 1, 2}));
+    EspacoProduto espaco;
+    assert(iguais(TT.paraMatriz(), multiplicarEsparso(tridiagonal, tridiagonal, espaco)));
+
+    // Diagonal x qualquer = escala de linhas; qualquer x diagonal = escala de colunas
+    assert(iguais(multiply(diagonal, B), multiplicarEsparso(diagonal, B, espaco)));
+    assert(iguais(multiply(*D, B), multiplicarEsparso(diagonal, B, espaco)));
+    assert(iguais(multiply(tridiagonal, diagonal), multiplicarEsparso(tridiagonal, diagonal, espaco)));
+    assert(iguais(multiply(*T, B), multiplicarEsparso(tridiagonal, B, espaco)));
+    assert(multiply(diagonal, B).verificarIntegridade());
+
+    // Detecção no construtor, antes de montar os nós: prevalece o último valor repetido
+    ConstrutorMatriz construtor(n, n);
+    for (int i = 1; i <= n; i++)
+        construtor.adicionar(i, i, 1);
+    construtor.adicionar(3, 3, 9);
+    std::optional<MatrizDiagonal> doConstrutor = MatrizDiagonal::detectar(construtor);
+    assert(doConstrutor && doConstrutor->get(3, 3) == 9 && doConstrutor->get(4, 4) == 1);
+    assert(construtor.quantidade() == static_cast<size_t>(n + 1));
+
+    // Leitura adaptativa: faixas viram DIA, o restante continua Matriz
+    const std::string caminho = (std::filesystem::temp_directory_path() / "teste_diagonal.mtx").string();
+    escreverMatriz(tridiagonal, caminho);
+    auto lidaFaixas = lerMatrizAdaptativa(caminho);
+    assert(std::holds_alternative<MatrizDiagonal>(lidaFaixas));
+    assert(iguais(std::get<MatrizDiagonal>(lidaFaixas).paraMatriz(), tridiagonal));
+
+    escreverMatriz(espalhada, caminho);
+    auto lidaEspalhada = lerMatrizAdaptativa(caminho);
+    assert(std::holds_alternative<Matriz>(lidaEspalhada) && iguais(std::get<Matriz>(lidaEspalhada), espalhada));
+    std::filesystem::remove(caminho);
+
+    bool rejeitado = false;
+    try
+    {
+        multiply(*D, Matriz(n + 1, 3));
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de matriz diagonal passou" << std::endl;
+}
+
+/*
+ *  @brief Testa os contadores O(1): total de elementos, por linha e por coluna, densidade e memória estimada.
+ */
+void testeEstatisticas()
+{
+    Matriz A(6, 8);
+    assert(A.quantidade() == 0 && A.densidade() == 0);
+    const size_t memoriaVazia = A.memoryUsage();
+
+    A.insert(1, 1, 2);
+    A.insert(1, 5, 3);
+    A.insert(4, 5, 1);
+    A.insert(1, 5, 7); // Sobrescreve: não conta de novo
+    A.insert(2, 2, 0); // Zero não é armazenado
+    assert(A.quantidade() == 3 && A.quantidadeLinha(1) == 2 && A.quantidadeColuna(5) == 2);
+    assert(std::fabs(A.densidade() - 3.0 / 48) < 1e-15);
+    assert(A.memoryUsage() == memoriaVazia + 3 * sizeof(Node));
+
+    assert(A.erase(1, 1) && !A.erase(1, 1));
+    assert(A.quantidade() == 2 && A.quantidadeLinha(1) == 1 && A.quantidadeColuna(1) == 0);
+
+    // Cópias compartilham a estrutura; a separação copia os contadores
+    Matriz B = A;
+    B.insert(6, 8, 1);
+    assert(A.quantidade() == 2 && B.quantidade() == 3 && B.quantidadeLinha(6) == 1);
+    assert(A.verificarIntegridade() && B.verificarIntegridade());
+
+    // Operações no lugar
+    Matriz C = B;
+    C -= B;
+    assert(C.quantidade() == 0 && C.quantidadeColuna(5) == 0 && C.verificarIntegridade());
+    C += B;
+    C += A;
+    assert(C.quantidade() == 3 && C.verificarIntegridade());
+    C.hadamard(A);
+    assert(C.quantidade() == 2 && C.quantidadeLinha(6) == 0 && C.verificarIntegridade());
+    C *= 0;
+    assert(C.quantidade() == 0 && C.quantidadeLinha(1) == 0);
+    B.limpar();
+    assert(B.quantidade() == 0 && B.quantidadeColuna(8) == 0 && B.verificarIntegridade());
+
+    // Construtor e permutação
+    ConstrutorMatriz construtor(5, 5);
+    for (int i = 1; i <= 5; i++)
+        for (int j = i; j <= 5; j++)
+            construtor.adicionar(i, j, i + j);
+    construtor.adicionar(1, 1, 9);
+    Matriz triangular = construtor.construir();
+    assert(triangular.quantidade() == 15 && triangular.quantidadeLinha(1) == 5 && triangular.quantidadeColuna(1) == 1);
+    Matriz invertida = triangular.applyPermutation({5, 4, 3, 2, 1}, {5, 4, 3, 2, 1});
+    assert(invertida.quantidadeLinha(1) == 1 && invertida.quantidadeColuna(1) == 5 && invertida.verificarIntegridade());
+    assert(multiply(triangular, triangular).verificarIntegridade());
+
+    // Escritores concorrentes em linhas diferentes atualizam o total sem perder incrementos
+    Matriz D(400, 400);
+    D.habilitarConcorrencia(16);
+    std::vector<std::thread> escritores;
+    for (int t = 0; t < 4; t++)
+    {
+        escritores.emplace_back([&D, t]()
+                                {
+                                    for (int i = t + 1; i <= 400; i += 4)
+                                        for (int j = 1; j <= 400; j += 7)
+                                            D.insert(i, j, i + j); });
+    }
+    for (std::thread &escritor : escritores)
+        escritor.join();
+    assert(D.quantidade() == 400 * 58 && D.quantidadeColuna(1) == 400 && D.verificarIntegridade());
+
+    bool rejeitado = false;
+    try
+    {
+        A.quantidadeLinha(7);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejeitado = true;
+    }
+    assert(rejeitado);
+
+    std::cout << "Teste de estatísticas estruturais passou" << std::endl;
+}
+
+/*
+ *  @brief Testa operator==, approxEqual() e primeiraDiferenca() pela fusão das linhas.
+ */
+void testeComparacao()
+{
+    Matriz A(4, 5);
+    A.insert(1, 2, 1.5);
+    A.insert(2, 4, -3);
+    A.insert(4, 1, 2);
+    A.insert(4, 5, 7);
+
+    Matriz copia = A;
+    assert(copia == A && !copia.primeiraDiferenca(A));
+
+    // Valor diferente: a primeira posição em ordem de linhas é informada
+    Matriz B = A;
+    B.insert(4, 5, 8);
+    B.insert(2, 4, -4);
+    std::optional<DiferencaMatriz> diferenca = A.primeiraDiferenca(B);
+    assert(!(A == B) && diferenca && diferenca->linha == 2 && diferenca->coluna == 4);
+    assert(diferenca->valorA == -3 && diferenca->valorB == -4);
+
+    // Elemento presente em apenas uma das matrizes
+    Matriz C = A;
+    C.insert(3, 3, 1);
+    diferenca = C.primeiraDiferenca(A);
+    assert(diferenca && diferenca->linha == 3 && diferenca->coluna == 3 && diferenca->valorA == 1 && diferenca->valorB == 0);
+    assert(A.erase(4, 1));
+    diferenca = copia.primeiraDiferenca(A);
+    assert(diferenca && diferenca->linha == 4 && diferenca->coluna == 1 && diferenca->valorB == 0);
+
+    // Tolerâncias relativa e absoluta
+    Matriz D = copia;
+    D.insert(4, 5, 7 * (1 + 1e-12));
+    assert(!(D == copia) && D.approxEqual(copia) && !D.approxEqual(copia, 0.0));
+    D.insert(3, 1, 1e-10);
+    DiferencaMatriz onde;
+    assert(!D.approxEqual(copia, 1e-9, 0.0, &onde) && onde.linha == 3 && onde.coluna == 1);
+    assert(D.approxEqual(copia, 1e-9, 1e-9));
+
+    // Dimensões diferentes
+    diferenca = Matriz(4, 4).primeiraDiferenca(Matriz(4, 5));
+    assert(diferenca && diferenca->linha == 0 && diferenca->coluna == 0);
+
+    // Zero armazenado pelo produto com padrão fixo equivale a uma posição vazia
+    Matriz linha(1, 2), coluna(2, 1);
+    linha.insert(1, 1, 1);
+    linha.insert(1, 2, 1);
+    coluna.insert(1, 1, 2);
+    coluna.insert(2, 1, 3);
+    ProdutoEsparso produto(linha, coluna);
+    coluna.insert(2, 1, -2);
+    assert(produto.calcular(linha, coluna) == Matriz(1, 1));
+
+    std::cout << "Teste de comparação de matrizes passou" << std::endl;
+}
+
+/*
+ *  @brief Testa o recurso de memória dos nós: contabilidade do RecursoMonitorado, limite de bytes e arenas.
+ */
+void testeRecursoMemoria()
+{
+    const size_t no = sizeof(Node);
+    RecursoMonitorado monitorado;
+
+    {
+        Matriz A(10, 8, &monitorado);
+        assert(A.getRecurso() == &monitorado);
+        assert(monitorado.getBytesEmUso() == (1 + 10 + 8) * no && monitorado.getAlocacoes() == 19);
+
+        A.insert(1, 1, 1);
+        A.insert(2, 3, 2);
+        A.insert(10, 8, 3);
+        assert(A.erase(2, 3));
+        assert(monitorado.getBytesEmUso() == 21 * no && monitorado.getDesalocacoes() == 1);
+
+        // A cópia separada pelo copy-on-write fica no mesmo recurso
+        Matriz B = A;
+        B.insert(5, 5, 4);
+        assert(B.getRecurso() == &monitorado && monitorado.getBytesEmUso() == (21 + 22) * no);
+
+        Matriz C = A.applyPermutation({}, {8, 7, 6, 5, 4, 3, 2, 1});
+        assert(C.getRecurso() == &monitorado && C.get(1, 8) == 1);
+
+        ConstrutorMatriz construtor(4, 4);
+        construtor.adicionar(2, 2, 1);
+        Matriz D = construtor.construir(&monitorado);
+        assert(D.getRecurso() == &monitorado && D.verificarIntegridade());
+
+        // sum() e multiply() alocam o resultado no recurso padrão, fora do orçamento dos operandos
+        const size_t emUso = monitorado.getBytesEmUso();
+        Matriz soma = sum(A, B), produto = multiply(D, D);
+        assert(soma.getRecurso() == std::pmr::get_default_resource() && soma.get(5, 5) == 4 && soma.get(1, 1) == 2);
+        assert(produto.getRecurso() == std::pmr::get_default_resource() && produto.get(2, 2) == 1);
+        assert(monitorado.getBytesEmUso() == emUso);
+    }
+    assert(monitorado.getBytesEmUso() == 0 && monitorado.getAlocacoes() == monitorado.getDesalocacoes());
+    assert(monitorado.getPicoBytes() >= (21 + 22 + 21) * no);
+
+    // Limite: a inserção que ultrapassa o orçamento falha e a matriz continua íntegra
+    RecursoMonitorado limitado((1 + 5 + 5 + 3) * no);
+    {
+        Matriz E(5, 5, &limitado);
+        E.insert(1, 1, 1);
+        E.insert(2, 2, 2);
+        E.insert(3, 3, 3);
+
+        bool recusada = false;
+        try
+        {
+            E.insert(4, 4, 4);
+        }
+        catch (const std::bad_alloc &)
+        {
+            recusada = true;
+        }
+        assert(recusada && limitado.getRecusadas() == 1);
+        assert(E.quantidade() == 3 && E.get(4, 4) == 0 && E.verificarIntegridade());
+
+        // Copiar também passa pelo orçamento; a cópia parcial é desfeita
+        recusada = false;
+        try
+        {
+            Matriz F = E;
+            F.insert(1, 1, 5);
+        }
+        catch (const std::bad_alloc &)
+        {
+            recusada = true;
+        }
+        assert(recusada && limitado.getBytesEmUso() == 14 * no);
+
+        E.erase(3, 3);
+        E.insert(4, 4, 4);
+        assert(E.get(4, 4) == 4);
+    }
+    assert(limitado.getBytesEmUso() == 0);
+
+    // Falhas durante a criação dos sentinelas e durante o ConstrutorMatriz não deixam memória para trás
+    bool recusada = false;
+    try
+    {
+        Matriz G(20, 20, &limitado);
+    }
+    catch (const std::bad_alloc &)
+    {
+        recusada = true;
+    }
+    assert(recusada && limitado.getBytesEmUso() == 0);
+
+    limitado.setLimite(30 * no);
+    ConstrutorMatriz construtor(5, 5);
+    for (int i = 1; i <= 5; i++)
+        for (int j = 1; j <= 5; j++)
+            construtor.adicionar(i, j, i * j);
+    recusada = false;
+    try
+    {
+        construtor.construir(&limitado);
+    }
+    catch (const std::bad_alloc &)
+    {
+        recusada = true;
+    }
+    assert(recusada && limitado.getBytesEmUso() == 0);
+
+    // Arena sem desalocação individual
+    std::pmr::monotonic_buffer_resource arena;
+    Matriz H(50, 50, &arena);
+    for (int i = 1; i <= 50; i++)
+        H.insert(i, 51 - i, i);
+    H.erase(1, 50);
+    assert(H.quantidade() == 49 && H.verificarIntegridade());
+
+    recusada = false;
+    try
+    {
+        Matriz I(2, 2, nullptr);
+    }
+    catch (const std::invalid_argument &)
+    {
+        recusada = true;
+    }
+    assert(recusada);
+
+    std::cout << "Teste de recurso de memória passou" << std::endl;
+}
+
+/*
+ *  @brief Testa o RegistroMatrizes: despejo LRU para o disco, recarga transparente e estatísticas.
+ */
+void testeRegistro()
+{
+    auto montar = [](const int &semente)
+    {
+        Matriz M(60, 60);
+        for (int i = 1; i <= 60; i++)
+            M.insert(i, (i * semente) % 60 + 1, i + semente);
+        return M;
+    };
+
+    const Matriz A = montar(7), B = montar(11), C = montar(13);
+    std::filesystem::path diretorio;
+
+    {
+        RegistroMatrizes registro;
+        diretorio = registro.getDiretorio();
+        assert(std::filesystem::is_directory(diretorio));
+
+        assert(registro.inserir("A", A) && registro.inserir("B", B) && registro.inserir("C", C));
+        assert(!registro.inserir("A", C) && registro.size() == 3);
+
+        // Cabem apenas duas: a menos usada recentemente (A) vai para o disco
+        const size_t bytes = A.memoryUsage();
+        registro.setOrcamento(2 * bytes + bytes / 2);
+        EstatisticasRegistro uso = registro.getEstatisticas();
+        assert(uso.despejos == 1 && uso.gravacoes == 1 && uso.emDisco == 1 && uso.emMemoria == 2);
+        assert(!registro.resumo("A").emMemoria && registro.resumo("A").quantidade == 60);
+
+        // Recarga transparente; agora B é a menos usada
+        Matriz recarregada = registro.obter("A");
+        assert(recarregada == A && registro.getEstatisticas().faltas == 1);
+        assert(!registro.resumo("B").emMemoria && registro.resumo("C").emMemoria);
+
+        assert(registro.obter("C") == C && registro.getEstatisticas().acertos == 1);
+
+        // A cópia devolvida continua válida após o despejo e não altera a matriz registrada
+        recarregada.insert(1, 1, 99);
+        assert(registro.obter("B") == B && !registro.resumo("A").emMemoria);
+        assert(recarregada.get(1, 1) == 99);
+
+        // O instantâneo de A continua válido: despejá-la de novo não regravou o arquivo
+        uso = registro.getEstatisticas();
+        assert(uso.despejos == 3 && uso.gravacoes == 2);
+        assert(registro.obter("A") == A);
+
+        // definir() substitui a matriz e descarta o instantâneo antigo
+        registro.definir("A", recarregada);
+        assert(registro.obter("A").get(1, 1) == 99);
+        assert(registro.remover("A") && !registro.contem("A") && !registro.remover("A"));
+
+        std::vector<InfoRegistro> lista = registro.listar();
+        assert(lista.size() == 2 && lista[0].nome == "B" && lista[1].nome == "C");
+
+        bool rejeitado = false;
+        try
+        {
+            registro.obter("A");
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejeitado = true;
+        }
+        assert(rejeitado);
+    }
+
+    assert(!std::filesystem::exists(diretorio));
+
+    std::cout << "Teste de registro de matrizes passou" << std::endl;
+}
+
+/*
+ *  @brief Testa o CacheResultados: acertos com operandos inalterados e invalidação por versão/identidade.
+ */
+void testeCacheResultados()
+{
+    Matriz A(20, 20), B(20, 20);
+    for (int i = 1; i <= 20; i++)
+    {
+        A.insert(i, i, i);
+        A.insert(i, 21 - i, 1);
+        B.insert(i, (i % 20) + 1, 2);
+    }
+
+    CacheResultados cache(3);
+
+    // Operandos inalterados: o segundo pedido devolve o mesmo resultado sem recalcular
+    const Matriz S1 = cache.somar(A, B);
+    const Matriz S2 = cache.somar(A, B);
+    assert(cache.getFaltas() == 1 && cache.getAcertos() == 1);
+    assert(S1.getIdentidade() == S2.getIdentidade() && S1 == sum(A, B));
+
+    // Uma cópia compartilha identidade e versão, então também acerta
+    const Matriz copiaA = A;
+    cache.somar(copiaA, B);
+    assert(cache.getAcertos() == 2);
+
+    // Alterar o resultado devolvido não altera o guardado
+    Matriz S3 = cache.somar(A, B);
+    S3.insert(1, 20, 99);
+    assert(cache.somar(A, B) == S1);
+
+    // Editar uma matriz compartilhada a separa com identidade nova: o resultado antigo não é mais encontrado
+    const uint64_t identidade = A.getIdentidade();
+    Matriz copiaEditada = A;
+    copiaEditada.insert(2, 3, 5);
+    assert(copiaEditada.getIdentidade() != identidade && A.getIdentidade() == identidade);
+    A.insert(2, 3, 5);
+    assert(A.getIdentidade() != identidade);
+    const size_t faltas = cache.getFaltas();
+    assert(cache.somar(A, B) == sum(A, B) && cache.getFaltas() == faltas + 1);
+
+    // A cópia editada ficou com estrutura própria e não invalidou o resultado do original (antes da edição)
+    assert(cache.somar(copiaA, B) == S1 && cache.getFaltas() == faltas + 1);
+
+    // Sem compartilhamento, insert(), erase(), += e limpar() mantêm a identidade e avançam a versão
+    uint64_t antes = B.getVersao();
+    B.insert(20, 20, 4);
+    assert(B.getVersao() > antes);
+    antes = B.getVersao();
+    B.erase(1, 2);
+    assert(B.getVersao() > antes);
+    antes = B.getVersao();
+    B += A;
+    assert(B.getVersao() > antes);
+
+    // Multiplicação é guardada separadamente da soma
+    const Matriz P1 = cache.multiplicar(A, B);
+    cache.multiplicar(A, B);
+    assert(P1 == multiply(A, B) && cache.size() == 3);
+
+    // Percorrer B com o iterador mutável apenas lendo não avança a versão: o resultado continua guardado
+    antes = B.getVersao();
+    double somaB = 0;
+    for (IteratorM it = B.begin(); it != B.end(); ++it)
+        somaB += *it;
+    assert(somaB != 0 && B.getVersao() == antes);
+    const size_t acertos = cache.getAcertos();
+    assert(cache.multiplicar(A, B) == P1 && cache.getAcertos() == acertos + 1);
+
+    // Uma escrita pelo iterador avança a versão: o resultado antigo não é devolvido
+    *B.begin() = 7;
+    assert(B.getVersao() > antes);
+    const size_t faltasEscrita = cache.getFaltas();
+    const Matriz P2 = cache.multiplicar(A, B);
+    assert(P2 == multiply(A, B) && !(P2 == P1) && cache.getFaltas() == faltasEscrita + 1);
+
+    antes = B.getVersao();
+    B.limpar();
+    assert(B.getVersao() > antes && cache.multiplicar(A, B).quantidade() == 0);
+
+    // Capacidade 3: a entrada menos usada recentemente (copiaA + B) foi descartada
+    assert(cache.size() == 3);
+    const size_t faltasAntes = cache.getFaltas();
+    cache.somar(copiaA, Matriz(S1.getLinhas(), S1.getColunas()));
+    assert(cache.getFaltas() == faltasAntes + 1);
+
+    cache.limpar();
+    assert(cache.size() == 0 && cache.getBytes() == 0);
+
+    // Limite em bytes: cabe um resultado de cada vez, e um maior que o limite não é guardado
+    const size_t tamanhoSoma = sum(A, B).memoryUsage();
+    CacheResultados limitado(8, tamanhoSoma + tamanhoSoma / 2);
+    limitado.somar(A, B);
+    limitado.somar(A, A);
+    assert(limitado.size() == 1 && limitado.getBytes() <= limitado.getLimiteBytes());
+    limitado.somar(A, A);
+    assert(limitado.getAcertos() == 1);
+    limitado.somar(A, B);
+    assert(limitado.getAcertos() == 1 && limitado.size() == 1);
+
+    CacheResultados pequeno(8, tamanhoSoma / 2);
+    assert(pequeno.somar(A, B) == sum(A, B) && pequeno.size() == 0 && pequeno.getBytes() == 0);
+
+    // Capacidade 0 desabilita o cache
+    CacheResultados desabilitado(0);
+    desabilitado.somar(A, A);
+    desabilitado.somar(A, A);
+    assert(desabilitado.getAcertos() == 0 && desabilitado.size() == 0);
+
+    std::cout << "Teste de cache de resultados passou" << std::endl;
+}
+
+/*
+ *  @brief Testa VisaoMatriz: blocos sem cópia, materialize(), sum/multiply/produto matriz-vetor e visões aninhadas.
+ */
+void testeVisaoMatriz()
+{
+    Matriz A(40, 30), B(30, 25);
+    for (int i = 1; i <= 40; i++)
+        for (int j = 1; j <= 30; j++)
+            if ((i * 7 + j * 3) % 5 == 0)
+                A.insert(i, j, i - j + 0.5);
+    for (int i = 1; i <= 30; i++)
+        for (int j = 1; j <= 25; j++)
+            if ((i + 2 * j) % 4 == 0)
+                B.insert(i, j, i * 0.25 + j);
+
+    // Bloco copiado elemento a elemento, como referência
+    auto copiarBloco = [](const Matriz &M, const int &r1, const int &r2, const int &c1, const int &c2)
+    {
+        Matriz bloco(r2 - r1 + 1, c2 - c1 + 1);
+        for (int i = r1; i <= r2; i++)
+            for (int j = c1; j <= c2; j++)
+                if (M.get(i, j) != 0)
+                    bloco.insert(i - r1 + 1, j - c1 + 1, M.get(i, j));
+        return bloco;
+    };
+
+    // Faixa estreita de colunas (índice pelas colunas) e faixa larga com poucas linhas (índice pelas linhas)
+    const VisaoMatriz estreita = A.view(1, 40, 11, 13);
+    const VisaoMatriz larga = A.view(5, 7, 2, 30);
+    const Matriz blocoEstreito = copiarBloco(A, 1, 40, 11, 13);
+    assert(estreita.getLinhas() == 40 && estreita.getColunas() == 3);
+    assert(estreita.materialize() == blocoEstreito);
+    assert(larga.materialize() == copiarBloco(A, 5, 7, 2, 30));
+    assert(estreita.quantidade() == blocoEstreito.quantidade());
+    assert(estreita.get(5, 2) == A.get(5, 12) && larga.get(1, 1) == A.get(5, 2));
+
+    // A visão não copia os elementos: compartilha a estrutura de A
+    assert(A.compartilhada() && estreita.getBase().getIdentidade() == A.getIdentidade());
+
+    // Visões aninhadas usam índices relativos
+    const VisaoMatriz interna = A.view(10, 30, 5, 25).view(3, 8, 2, 6);
+    assert(interna.materialize() == copiarBloco(A, 12, 17, 6, 10));
+
+    // sum() e multiply() com blocos e com combinações de matriz e bloco
+    const VisaoMatriz blocoA = A.view(11, 35, 6, 30), blocoB = B.view(1, 25, 1, 25);
+    assert(sum(blocoA, blocoB) == sum(blocoA.materialize(), blocoB.materialize()));
+    assert(multiply(blocoA, blocoB) == multiply(blocoA.materialize(), blocoB.materialize()));
+    assert(multiply(A, B.view(1, 30, 3, 9)) == multiply(A, copiarBloco(B, 1, 30, 3, 9)));
+    assert(multiply(A.view(1, 40, 1, 30), B) == multiply(A, B));
+
+    bool lancou = false;
+    try
+    {
+        sum(A.view(1, 2, 1, 2), A.view(1, 3, 1, 2));
+    }
+    catch (const std::invalid_argument &)
+    {
+        lancou = true;
+    }
+    assert(lancou);
+
+    // Produto matriz-vetor sobre o bloco
+    std::vector<double> x(blocoA.getColunas()), y, esperado(blocoA.getLinhas(), 0.0);
+    for (size_t k = 0; k < x.size(); k++)
+        x[k] = 1.0 + k * 0.5;
+    blocoA.multiplicar(x, y);
+    for (int i = 1; i <= blocoA.getLinhas(); i++)
+        for (int j = 1; j <= blocoA.getColunas(); j++)
+            esperado[i - 1] += blocoA.get(i, j) * x[j - 1];
+    assert(y == esperado);
+
+    // Faixas inválidas
+    for (const auto &faixa : std::vector<std::array<int, 4>>{{0, 1, 1, 1}, {2, 1, 1, 1}, {1, 41, 1, 1}, {1, 1, 5, 31}})
+    {
+        lancou = false;
+        try
+        {
+            A.view(faixa[0], faixa[1], faixa[2], faixa[3]);
+        }
+        catch (const std::invalid_argument &)
+        {
+            lancou = true;
+        }
+        assert(lancou);
+    }
+
+    // A visão guarda o estado da criação: alterar A separa a estrutura e não altera a visão
+    A.insert(12, 11, 1234);
+    assert(estreita.materialize() == blocoEstreito && estreita.get(12, 1) != 1234);
+    assert(A.view(1, 40, 11, 13).get(12, 1) == 1234);
+
+    std::cout << "Teste de visão de matriz passou" << std::endl;
+}
+
+/*
+ *  @brief Testa as reduções: somas de linhas e colunas, normas, traço, mínimo e máximo, com uma e com várias threads.
+ */
+void testeReducoes()
+{
+    Matriz A(4, 3);
+    A.insert(1, 1, 2);
+    A.insert(1, 3, -5);
+    A.insert(2, 2, 4);
+    A.insert(3, 1, -1);
+    A.insert(3, 2, 3);
+    A.insert(3, 3, 7);
+
+    assert((A.somaLinhas() == std::vector<double>{-3, 4, 9, 0}));
+    assert((A.somaColunas() == std::vector<double>{1, 7, 2}));
+    assert(A.norma1() == 12 && A.normaInfinito() == 11);
+    assert(std::abs(A.normaFrobenius() - std::sqrt(104.0)) < 1e-12);
+    assert(A.minimo() == -5 && A.maximo() == 7);
+
+    // Posições não armazenadas contam como zero no mínimo e no máximo
+    Matriz positiva(2, 2);
+    positiva.insert(1, 1, 3);
+    positiva.insert(2, 2, 8);
+    assert(positiva.minimo() == 0 && positiva.maximo() == 8 && positiva.traco() == 11);
+
+    bool lancou = false;
+    try
+    {
+        A.traco();
+    }
+    catch (const std::invalid_argument &)
+    {
+        lancou = true;
+    }
+    assert(lancou);
+    assert(Matriz().normaFrobenius() == 0 && Matriz().maximo() == 0);
+
+    // Matriz grande o bastante para dividir as listas entre threads: o resultado não depende da quantidade
+    const int n = 600;
+    ConstrutorMatriz construtor(n, n);
+    for (int i = 1; i <= n; i++)
+        for (int j = 1; j <= n; j++)
+            if ((i * 31 + j * 17) % 3 == 0)
+                construtor.adicionar(i, j, 1.0 / (i + j) - 0.003 * ((i * j) % 7));
+    const Matriz M = construtor.construir();
+
+    assert(M.somaLinhas(1) == M.somaLinhas(4) && M.somaColunas(1) == M.somaColunas(3));
+    assert(M.normaFrobenius(1) == M.normaFrobenius(4) && M.norma1(1) == M.norma1(5));
+    assert(M.normaInfinito(1) == M.normaInfinito(2) && M.minimo(1) == M.minimo(4) && M.maximo(1) == M.maximo(4));
+
+    // Comparação com o percurso denso
+    const std::vector<double> linhas = M.somaLinhas(), colunas = M.somaColunas();
+    double frobenius = 0, traco = 0;
+    for (int i = 1; i <= n; i++)
+    {
+        double somaLinha = 0;
+        for (int j = 1; j <= n; j++)
+        {
+            somaLinha += M.get(i, j);
+            frobenius += M.get(i, j) * M.get(i, j);
+        }
+        traco += M.get(i, i);
+        assert(std::abs(somaLinha - linhas[i - 1]) < 1e-9);
+    }
+    for (int j = 1; j <= n; j += 37)
+    {
+        double somaColuna = 0;
+        for (int i = 1; i <= n; i++)
+            somaColuna += M.get(i, j);
+        assert(std::abs(somaColuna - colunas[j - 1]) < 1e-9);
     }
+    assert(std::abs(std::sqrt(frobenius) - M.normaFrobenius()) < 1e-9);
+    assert(std::abs(traco - M.traco()) < 1e-9);
+
+    std::cout << "Teste de reduções passou" << std::endl;
+}
+
+/*
+ *  @brief Testa a poda: prune() no lugar e multiply() com tolerância e limite de elementos por linha.
+ */
+void testePoda()
+{
+    Matriz A(30, 30), B(30, 30);
+    for (int i = 1; i <= 30; i++)
+        for (int j = 1; j <= 30; j++)
+        {
+            if ((i + j) % 3 == 0)
+                A.insert(i, j, std::sin(i * 1.3 + j) * std::pow(10.0, -(j % 5)));
+            if ((i * j) % 4 == 1)
+                B.insert(i, j, std::cos(i - j * 0.7));
+        }
 
-    // Verificando cada valor da matriz resultante
-    for (int i = 1; i <= multi.getLinhas(); i++)
+    const Matriz completo = multiply(A, B);
+
+    // Tolerância: mesmo resultado que multiplicar e podar depois, sem alocar os elementos descartados
+    Matriz podado = completo;
+    const size_t removidos = podado.prune(1e-3);
+    assert(removidos > 0 && podado.quantidade() + removidos == completo.quantidade());
+    assert(multiply(A, B, OpcoesPoda{1e-3, 0}) == podado);
+    assert(podado.verificarIntegridade());
+    for (auto it = podado.begin(); it != podado.end(); ++it)
+        assert(std::abs(*it) >= 1e-3);
+
+    // Maiores por linha: no máximo k elementos, e nenhum descartado supera um mantido
+    const size_t k = 3;
+    const Matriz limitado = multiply(A, B, OpcoesPoda{0.0, k});
+    for (int i = 1; i <= 30; i++)
     {
-        for (int j = 1; j <= multi.getColunas(); j++)
+        assert(limitado.quantidadeLinha(i) == std::min<int>(k, completo.quantidadeLinha(i)));
+
+        double menorMantido = INFINITY, maiorDescartado = 0;
+        for (int j = 1; j <= 30; j++)
         {
-            if (D.get(i, j) != multi.get(i, j))
+            if (limitado.get(i, j) != 0)
+            {
+                assert(limitado.get(i, j) == completo.get(i, j));
+                menorMantido = std::min(menorMantido, std::abs(completo.get(i, j)));
+            }
+            else
             {
-                throw std::runtime_error("Erro na multiplicação das matrizes: Valor incorreto na posição (" +
-                                         std::to_string(i) + ", " + std::to_string(j) + "). Esperado: " +
-                                         std::to_string(multi.get(i, j)) + ", Obtido: " + std::to_string(D.get(i, j)));
+                maiorDescartado = std::max(maiorDescartado, std::abs(completo.get(i, j)));
             }
         }
+        assert(limitado.quantidadeLinha(i) == 0 || maiorDescartado <= menorMantido);
     }
+    Matriz limitadoDepois = completo;
+    limitadoDepois.prune(0.0, k);
+    assert(limitadoDepois == limitado && limitadoDepois.verificarIntegridade());
+    assert(multiply(A.view(1, 30, 1, 30), B, OpcoesPoda{0.0, k}) == limitado);
 
-    std::cout << "Teste de multiplicação passou" << std::endl;
+    // Empates no limiar favorecem as colunas menores
+    Matriz empates(2, 6);
+    for (int j = 1; j <= 6; j++)
+        empates.insert(1, j, j % 2 == 0 ? -2.0 : 2.0);
+    empates.insert(2, 4, 9);
+    assert(empates.prune(0.0, 4) == 2);
+    assert(empates.quantidadeLinha(1) == 4 && empates.get(1, 4) == -2 && empates.get(1, 5) == 0);
+    assert(empates.quantidadeColuna(5) == 0 && empates.quantidadeColuna(6) == 0 && empates.get(2, 4) == 9);
+
+    // Nada a remover: uma cópia compartilhada não é separada
+    Matriz copia = completo;
+    assert(copia.prune(0.0) == 0 && copia.compartilhada());
+
+    bool lancou = false;
+    try
+    {
+        copia.prune(-1.0);
+    }
+    catch (const std::invalid_argument &)
+    {
+        lancou = true;
+    }
+    assert(lancou);
+
+    std::cout << "Teste de poda passou" << std::endl;
 }
 
 /*
@@ -202,6 +2155,24 @@ void testePerformance()
 
     auto duracao2 = std::chrono::duration_cast<std::chrono::milliseconds>(fim2 - inicio2);
     std::cout << "Tempo para Multiplição: " << duracao2.count() << "ms" << std::endl;
+
+    MatrizHibrida hA(A), hB(B);
+
+    auto inicio3 = std::chrono::high_resolution_clock::now();
+    MatrizHibrida hMulti = multiply(hA, hB); // Multiplica usando os ladrilhos densos
+    auto fim3 = std::chrono::high_resolution_clock::now();
+
+    auto duracao3 = std::chrono::duration_cast<std::chrono::milliseconds>(fim3 - inicio3);
+    std::cout << "Tempo para Multiplição (ladrilhos densos): " << duracao3.count() << "ms" << std::endl;
+
+    ProdutoEsparso produto(A, B); // Fase simbólica fora da medição
+
+    auto inicio4 = std::chrono::high_resolution_clock::now();
+    produto.calcular(A, B); // Apenas a fase numérica, sem alocações
+    auto fim4 = std::chrono::high_resolution_clock::now();
+
+    auto duracao4 = std::chrono::duration_cast<std::chrono::milliseconds>(fim4 - inicio4);
+    std::cout << "Tempo para Multiplição (fase numérica): " << duracao4.count() << "ms" << std::endl;
 }
 
 /**
@@ -288,6 +2259,29 @@ int main()
 
         std::cout << "Testes de inserção e de Performance, sendo esta com uma martriz 100x100" << std::endl;
         testeInsercao();    // Teste básico de inserção
+        testeMatrizHibrida();
+        testeMatrizHash();
+        testeInsercaoConcorrente();
+        testeCopiaSobEscrita();
+        testeModoLote();
+        testeMatrixMarket();
+        testeFormatoCompactado();
+        testeProdutoEsparso();
+        testeOperacoesNoLugar();
+        testePotencia();
+        testeProdutosTranspostos();
+        testeSolucionadores();
+        testeFatoracaoSimetrica();
+        testeReordenacaoRCM();
+        testeMatrizDiagonal();
+        testeEstatisticas();
+        testeComparacao();
+        testeRecursoMemoria();
+        testeRegistro();
+        testeCacheResultados();
+        testeVisaoMatriz();
+        testeReducoes();
+        testePoda();
         testePerformance(); // Teste de performance para matrizes grandes
     
     }
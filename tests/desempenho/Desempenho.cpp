@@ -0,0 +1,372 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include <regex>
+#include <map>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cstdint>
+#include <filesystem>
+#include "matriz/Matriz.hpp"
+#include "utils/utils.hpp"
+#include "io/MatrizIO.hpp"
+
+/**
+ * @file Desempenho.cpp
+ * @brief Verificação de regressões de desempenho (alvos perf-check e perf-baseline do makefile).
+ *
+ * Executa um conjunto fixo de medições, cada uma repetida várias vezes, e compara a mediana
+ * de cada uma com a mediana registrada no arquivo de referência. Uma medição é considerada
+ * uma regressão quando fica mais lenta que a referência por mais que a tolerância relativa
+ * e também por mais que a folga absoluta (que evita alarmes em medições de poucos microssegundos).
+ *
+ * Formato do arquivo de referência:
+ * @code
+ * {
+ *     "tolerancia": 0.5,
+ *     "folga_us": 200,
+ *     "medianas_us": {
+ *         "soma": 1234.5,
+ *         ...
+ *     }
+ * }
+ * @endcode
+ *
+ * As medianas dependem da máquina: após mudar de máquina, regrave a referência com `make perf-baseline`.
+ */
+
+namespace
+{
+    constexpr int n = 2000;       /**< Ordem das matrizes de inserção, soma e produto. */
+    constexpr int porLinha = 20;  /**< Elementos por linha nessas matrizes. */
+
+    /**
+     * @brief Medição do conjunto: o nome é a chave no arquivo de referência.
+     */
+    struct Medicao
+    {
+        std::string nome;
+        std::function<void()> preparar; /**< Executado antes de cada repetição, fora do tempo medido. */
+        std::function<void()> executar; /**< Trecho medido. */
+    };
+
+    /**
+     * @brief Referência lida do arquivo JSON.
+     */
+    struct Referencia
+    {
+        double tolerancia{0.5};
+        double folgaUs{200.0};
+        std::map<std::string, double> medianasUs;
+    };
+
+    /**
+     * @brief Gerador congruencial simples, para que as matrizes sejam as mesmas em toda execução.
+     */
+    struct Gerador
+    {
+        uint64_t estado;
+
+        int proximo(const int &limite)
+        {
+            estado = estado * 6364136223846793005ULL + 1442695040888963407ULL;
+            return static_cast<int>((estado >> 33) % static_cast<uint64_t>(limite));
+        }
+    };
+
+    /**
+     * @brief Monta uma matriz n x n com `porLinha` elementos em colunas pseudoaleatórias de cada linha.
+     */
+    Matriz matrizEspalhada(const int &n, const int &porLinha, const uint64_t &semente)
+    {
+        Gerador gerador{semente};
+        Matriz matriz(n, n);
+
+        for (int i = 1; i <= n; i++)
+            for (int k = 0; k < porLinha; k++)
+                matriz.insert(i, gerador.proximo(n) + 1, 1 + gerador.proximo(9));
+
+        return matriz;
+    }
+
+    /**
+     * @brief Executa a medição `repeticoes` vezes e retorna a mediana, em microssegundos.
+     */
+    double medir(const Medicao &medicao, const int &repeticoes)
+    {
+        std::vector<double> tempos;
+        tempos.reserve(repeticoes);
+
+        for (int r = 0; r < repeticoes; r++)
+        {
+            if (medicao.preparar)
+                medicao.preparar();
+
+            auto inicio = std::chrono::steady_clock::now();
+            medicao.executar();
+            auto fim = std::chrono::steady_clock::now();
+
+            tempos.push_back(std::chrono::duration<double, std::micro>(fim - inicio).count());
+        }
+
+        std::sort(tempos.begin(), tempos.end());
+        const size_t meio = tempos.size() / 2;
+        return tempos.size() % 2 ? tempos[meio] : (tempos[meio - 1] + tempos[meio]) / 2;
+    }
+
+    /**
+     * @brief Lê o arquivo de referência.
+     *
+     * Apenas o formato gravado por gravarReferencia() é reconhecido: um objeto com os números
+     * "tolerancia" e "folga_us" e o objeto "medianas_us" com um número por medição.
+     *
+     * @throws std::runtime_error Se o arquivo não puder ser aberto ou não tiver "medianas_us".
+     */
+    Referencia lerReferencia(const std::string &caminho)
+    {
+        std::ifstream arquivo(caminho);
+        if (!arquivo.is_open())
+            throw std::runtime_error("Erro: Não foi possível abrir a referência " + caminho);
+
+        std::stringstream buffer;
+        buffer << arquivo.rdbuf();
+        const std::string texto = buffer.str();
+
+        const std::regex par("\"([A-Za-z0-9_]+)\"\\s*:\\s*(-?[0-9.]+(?:[eE][-+]?[0-9]+)?)");
+        Referencia referencia;
+
+        const size_t medianas = texto.find("\"medianas_us\"");
+        if (medianas == std::string::npos)
+            throw std::runtime_error("Erro: A referência " + caminho + " não possui \"medianas_us\"");
+
+        for (std::sregex_iterator it(texto.begin(), texto.end(), par), fim; it != fim; ++it)
+        {
+            const std::string chave = (*it)[1];
+            const double valor = std::stod((*it)[2]);
+
+            if (static_cast<size_t>(it->position()) > medianas)
+                referencia.medianasUs[chave] = valor;
+            else if (chave == "tolerancia")
+                referencia.tolerancia = valor;
+            else if (chave == "folga_us")
+                referencia.folgaUs = valor;
+        }
+
+        return referencia;
+    }
+
+    /**
+     * @brief Grava as medianas medidas como nova referência, mantendo tolerância e folga.
+     *
+     * @throws std::runtime_error Se o arquivo não puder ser criado.
+     */
+    void gravarReferencia(const std::string &caminho, const Referencia &referencia,
+                          const std::vector<std::pair<std::string, double>> &medianas)
+    {
+        std::ofstream arquivo(caminho);
+        if (!arquivo.is_open())
+            throw std::runtime_error("Erro: Não foi possível criar a referência " + caminho);
+
+        arquivo << std::fixed << std::setprecision(1);
+        arquivo << "{\n";
+        arquivo << "    \"tolerancia\": " << std::setprecision(2) << referencia.tolerancia << ",\n";
+        arquivo << "    \"folga_us\": " << std::setprecision(1) << referencia.folgaUs << ",\n";
+        arquivo << "    \"medianas_us\": {\n";
+
+        for (size_t k = 0; k < medianas.size(); k++)
+        {
+            arquivo << "        \"" << medianas[k].first << "\": " << medianas[k].second
+                    << (k + 1 < medianas.size() ? ",\n" : "\n");
+        }
+
+        arquivo << "    }\n}\n";
+    }
+
+    /**
+     * @brief Monta o conjunto fixo de medições.
+     *
+     * Os tamanhos foram escolhidos para que cada medição leve de alguns a algumas dezenas de
+     * milissegundos: um caminho O(n²) reintroduzido em inserção, soma, produto ou get() passa a
+     * custar ordens de grandeza mais e ultrapassa qualquer tolerância razoável.
+     */
+    std::vector<Medicao> montarMedicoes()
+    {
+        // Operandos compartilhados, montados uma única vez
+        static const Matriz A = matrizEspalhada(n, porLinha, 1);
+        static const Matriz B = matrizEspalhada(n, porLinha, 2);
+        static const Matriz varredura = matrizEspalhada(1000, porLinha, 3);
+
+        static Matriz destino;
+        auto novoDestino = []()
+        { destino = Matriz(n, n); };
+
+        std::vector<Medicao> medicoes;
+
+        medicoes.push_back({"leitura_mgg", nullptr, []()
+                            { Matriz lida = lerMatrizTexto("src/arquivos/mgg.txt"); }});
+
+        medicoes.push_back({"insercao_crescente", novoDestino, []()
+                            {
+                                for (int i = 1; i <= n; i++)
+                                    for (int j = 1; j <= n; j += n / porLinha)
+                                        destino.insert(i, j, i + j);
+                            }});
+
+        medicoes.push_back({"insercao_decrescente", novoDestino, []()
+                            {
+                                for (int i = n; i >= 1; i--)
+                                    for (int j = n; j >= 1; j -= n / porLinha)
+                                        destino.insert(i, j, i + j);
+                            }});
+
+        medicoes.push_back({"insercao_espalhada", novoDestino, []()
+                            {
+                                Gerador gerador{4};
+                                for (int k = 0; k < n * porLinha; k++)
+                                    destino.insert(gerador.proximo(n) + 1, gerador.proximo(n) + 1, 1.0);
+                            }});
+
+        medicoes.push_back({"soma", nullptr, []()
+                            { Matriz C = sum(A, B); }});
+
+        medicoes.push_back({"multiplicacao", nullptr, []()
+                            { Matriz C = multiply(A, B); }});
+
+        medicoes.push_back({"get_varredura", nullptr, []()
+                            {
+                                volatile double total = 0;
+                                for (int i = 1; i <= varredura.getLinhas(); i++)
+                                    for (int j = 1; j <= varredura.getColunas(); j++)
+                                        total = total + varredura.get(i, j);
+                            }});
+
+        return medicoes;
+    }
+
+    void exibirUso()
+    {
+        std::cout << "Uso: desempenho [--referencia arquivo.json] [--gravar arquivo.json]\n"
+                  << "                  [--tolerancia fração] [--repeticoes n]\n";
+    }
+}
+
+/**
+ * @brief Executa as medições e compara com a referência ou a regrava.
+ *
+ * @return 0 se nenhuma medição regrediu (ou se a referência foi gravada), 1 em caso de regressão
+ *         ou erro, 2 se os argumentos forem inválidos.
+ */
+int main(int argc, char *argv[])
+{
+    std::string caminhoReferencia, caminhoGravacao;
+    double tolerancia = -1;
+    int repeticoes = 7;
+
+    try
+    {
+        for (int k = 1; k < argc; k++)
+        {
+            const std::string opcao = argv[k];
+
+            if (k + 1 >= argc)
+            {
+                exibirUso();
+                return 2;
+            }
+
+            const std::string valor = argv[++k];
+
+            if (opcao == "--referencia")
+                caminhoReferencia = valor;
+            else if (opcao == "--gravar")
+                caminhoGravacao = valor;
+            else if (opcao == "--tolerancia")
+                tolerancia = std::stod(valor);
+            else if (opcao == "--repeticoes")
+                repeticoes = std::stoi(valor);
+            else
+            {
+                exibirUso();
+                return 2;
+            }
+        }
+
+        if (repeticoes < 1 || (caminhoReferencia.empty() && caminhoGravacao.empty()))
+        {
+            exibirUso();
+            return 2;
+        }
+
+        Referencia referencia;
+        if (!caminhoReferencia.empty())
+            referencia = lerReferencia(caminhoReferencia);
+        else if (!caminhoGravacao.empty() && std::filesystem::exists(caminhoGravacao))
+            referencia = lerReferencia(caminhoGravacao);
+
+        if (tolerancia >= 0)
+            referencia.tolerancia = tolerancia;
+
+        std::vector<std::pair<std::string, double>> medianas;
+        int regressoes = 0;
+
+        std::cout << std::left << std::setw(25) << "Medição" << std::right << std::setw(15) << "Mediana (µs)"
+                  << std::setw(18) << "Referência (µs)" << std::setw(11) << "Razão" << "  Situação\n";
+
+        for (const Medicao &medicao : montarMedicoes())
+        {
+            const double mediana = medir(medicao, repeticoes);
+            medianas.emplace_back(medicao.nome, mediana);
+
+            std::cout << std::left << std::setw(24) << medicao.nome << std::right << std::fixed
+                      << std::setprecision(1) << std::setw(14) << mediana;
+
+            if (caminhoReferencia.empty())
+            {
+                std::cout << '\n';
+                continue;
+            }
+
+            auto registrada = referencia.medianasUs.find(medicao.nome);
+            if (registrada == referencia.medianasUs.end())
+            {
+                std::cout << std::setw(16) << "-" << std::setw(10) << "-" << "  sem referência\n";
+                continue;
+            }
+
+            const double limite = registrada->second * (1 + referencia.tolerancia);
+            const bool regrediu = mediana > limite && mediana - registrada->second > referencia.folgaUs;
+            regressoes += regrediu;
+
+            std::cout << std::setw(16) << registrada->second << std::setw(10) << std::setprecision(2)
+                      << mediana / registrada->second << "  " << (regrediu ? "REGRESSÃO" : "ok") << '\n';
+        }
+
+        if (!caminhoGravacao.empty())
+        {
+            gravarReferencia(caminhoGravacao, referencia, medianas);
+            std::cout << "Referência gravada em " << caminhoGravacao << std::endl;
+        }
+
+        if (regressoes > 0)
+        {
+            std::cerr << regressoes << " medição(ões) mais lenta(s) que a referência além da tolerância de "
+                      << std::fixed << std::setprecision(0) << referencia.tolerancia * 100 << "%" << std::endl;
+            return 1;
+        }
+
+        if (!caminhoReferencia.empty())
+            std::cout << "Nenhuma regressão de desempenho" << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}